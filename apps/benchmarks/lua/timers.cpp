@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+
+#include <components/esm/luascripts.hpp>
+#include <components/lua/configuration.hpp>
+#include <components/lua/luastate.hpp>
+#include <components/lua/scriptscontainer.hpp>
+#include <components/vfs/archive.hpp>
+#include <components/vfs/manager.hpp>
+
+#include <memory>
+#include <random>
+#include <sstream>
+
+namespace
+{
+    // Simulates mods setting up many short timers (e.g. per actor cooldowns) that expire over the next frames.
+    constexpr std::string_view scriptPath = "timers.lua";
+    constexpr int framesCount = 100;
+
+    class ScriptFile : public VFS::File
+    {
+    public:
+        Files::IStreamPtr open() override
+        {
+            return std::make_unique<std::stringstream>("return {}", std::ios_base::in);
+        }
+
+        std::filesystem::path getPath() override { return scriptPath; }
+    };
+
+    class ScriptArchive : public VFS::Archive
+    {
+    public:
+        void listResources(std::map<std::string, VFS::File*>& out) override
+        {
+            out.emplace(std::string(scriptPath), &mFile);
+        }
+
+        bool contains(const std::string& file) const override { return file == scriptPath; }
+
+        std::string getDescription() const override { return "Benchmark"; }
+
+    private:
+        ScriptFile mFile;
+    };
+
+    void setupAndProcessTimers(benchmark::State& state)
+    {
+        const std::int64_t count = state.range(0);
+
+        VFS::Manager vfs;
+        vfs.addArchive(std::make_unique<ScriptArchive>());
+        vfs.buildIndex();
+
+        ESM::LuaScriptsCfg luaScriptsCfg;
+        LuaUtil::parseOMWScripts(luaScriptsCfg, "CUSTOM: timers.lua\n");
+        LuaUtil::ScriptsConfiguration cfg;
+        cfg.init(std::move(luaScriptsCfg));
+
+        LuaUtil::LuaState lua(&vfs, &cfg);
+        LuaUtil::ScriptsContainer scripts(&lua, "Benchmark");
+        const int scriptId = *cfg.findId(scriptPath);
+        if (!scripts.addCustomScript(scriptId))
+        {
+            state.SkipWithError("Failed to add script");
+            return;
+        }
+
+        std::int64_t calls = 0;
+        sol::function callback = sol::make_object(lua.sol(), [&] { ++calls; });
+        std::minstd_rand random;
+        std::uniform_real_distribution<double> distribution(0, framesCount);
+        double time = 0;
+
+        for (auto _ : state)
+        {
+            for (std::int64_t i = 0; i < count; ++i)
+                scripts.setupUnsavableTimer(LuaUtil::ScriptsContainer::TimerType::SIMULATION_TIME,
+                    time + distribution(random), scriptId, callback);
+            for (int frame = 1; frame <= framesCount; ++frame)
+                scripts.processTimers(time + frame, 0);
+            time += framesCount;
+        }
+
+        benchmark::DoNotOptimize(calls);
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+}
+
+BENCHMARK(setupAndProcessTimers)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
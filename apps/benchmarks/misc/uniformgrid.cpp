@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <components/misc/uniformgrid.hpp>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Simulates proximity queries done by MWMechanics::Actors each frame: every actor looks for neighbours within
+    // some radius among all active actors.
+    constexpr float actorsArea = 3 * 8192.0f;
+    constexpr float cellSize = 512;
+
+    std::vector<osg::Vec3f> generatePositions(std::size_t count)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> distribution(0, actorsArea);
+        std::uniform_real_distribution<float> heightDistribution(-500, 500);
+        std::vector<osg::Vec3f> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            result.emplace_back(distribution(random), distribution(random), heightDistribution(random));
+        return result;
+    }
+
+    void linearSearch(benchmark::State& state)
+    {
+        const std::vector<osg::Vec3f> positions = generatePositions(static_cast<std::size_t>(state.range(0)));
+        const float radius = static_cast<float>(state.range(1));
+        std::vector<std::size_t> found;
+
+        for (auto _ : state)
+        {
+            for (const osg::Vec3f& position : positions)
+            {
+                found.clear();
+                for (std::size_t i = 0; i < positions.size(); ++i)
+                    if ((positions[i] - position).length2() <= radius * radius)
+                        found.push_back(i);
+                benchmark::DoNotOptimize(found);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void uniformGridSearch(benchmark::State& state)
+    {
+        const std::vector<osg::Vec3f> positions = generatePositions(static_cast<std::size_t>(state.range(0)));
+        const float radius = static_cast<float>(state.range(1));
+        Misc::UniformGrid<std::size_t> grid(cellSize);
+        std::vector<std::size_t> found;
+
+        for (auto _ : state)
+        {
+            // Grid is rebuilt each frame as actors move
+            grid.clear();
+            for (std::size_t i = 0; i < positions.size(); ++i)
+                grid.add(positions[i], i);
+            grid.build();
+            for (const osg::Vec3f& position : positions)
+            {
+                found.clear();
+                grid.findInRange(position, radius, found);
+                benchmark::DoNotOptimize(found);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+}
+
+BENCHMARK(linearSearch)->ArgsProduct({ { 100, 1000 }, { 200, 1600, 2048, 2560, 3072, 7168 } });
+BENCHMARK(uniformGridSearch)->ArgsProduct({ { 100, 1000 }, { 200, 1600, 2048, 2560, 3072, 7168 } });
+
+BENCHMARK_MAIN();
@@ -38,6 +38,7 @@
 #include <filesystem>
 #include <iostream>
 #include <map>
+#include <optional>
 #include <string>
 #include <thread>
 #include <type_traits>
@@ -121,6 +122,10 @@ namespace NavMeshTool
             addOption("remove-unused-tiles", bpo::value<bool>()->implicit_value(true)->default_value(false),
                 "remove tiles from cache that will not be used with current content profile");
 
+            addOption("incremental", bpo::value<bool>()->implicit_value(true)->default_value(false),
+                "process only cells changed since the last run and regenerate tiles affected by them, tiles of removed "
+                "worldspaces are deleted together with remove-unused-tiles");
+
             addOption("write-binary-log", bpo::value<bool>()->implicit_value(true)->default_value(false),
                 "write progress in binary messages to be consumed by the launcher");
 
@@ -181,6 +186,7 @@ namespace NavMeshTool
             const bool processInteriorCells = variables["process-interior-cells"].as<bool>();
             const bool removeUnusedTiles = variables["remove-unused-tiles"].as<bool>();
             const bool writeBinaryLog = variables["write-binary-log"].as<bool>();
+            const bool incremental = variables["incremental"].as<bool>();
 
 #ifdef WIN32
             if (writeBinaryLog)
@@ -206,6 +212,17 @@ namespace NavMeshTool
 
             DetourNavigator::NavMeshDb db(dbPath, maxDbFileSize);
 
+            std::optional<std::vector<DetourNavigator::CellFingerprint>> cellFingerprints;
+            if (incremental)
+            {
+                cellFingerprints = db.getCellFingerprints();
+                if (cellFingerprints->empty())
+                {
+                    Log(Debug::Warning) << "Navmeshdb has no data about processed cells, all cells will be processed";
+                    cellFingerprints.reset();
+                }
+            }
+
             ESM::ReadersCache readers;
             EsmLoader::Query query;
             query.mLoadActivators = true;
@@ -229,8 +246,9 @@ namespace NavMeshTool
             navigatorSettings.mRecast.mSwimHeightScale
                 = EsmLoader::getGameSetting(esmData.mGameSettings, "fSwimHeightScale").getFloat();
 
-            WorldspaceData cellsData = gatherWorldspaceData(
-                navigatorSettings, readers, vfs, bulletShapeManager, esmData, processInteriorCells, writeBinaryLog);
+            WorldspaceData cellsData = gatherWorldspaceData(navigatorSettings, agentBounds, readers, vfs,
+                bulletShapeManager, esmData, processInteriorCells, writeBinaryLog,
+                cellFingerprints.has_value() ? &*cellFingerprints : nullptr);
 
             const Status status = generateAllNavMeshTiles(agentBounds, navigatorSettings, threadsNumber,
                 removeUnusedTiles, writeBinaryLog, cellsData, std::move(db));
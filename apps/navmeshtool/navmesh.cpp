@@ -21,10 +21,12 @@
 
 #include <osg/Vec3f>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <random>
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -149,7 +151,6 @@ namespace NavMeshTool
                     std::lock_guard lock(mMutex);
                     if (mRemoveUnusedTiles)
                         mDeleted += static_cast<std::size_t>(mDb.deleteTilesAt(worldspace, tilePosition));
-                    data.mUserId = static_cast<unsigned>(mNextTileId);
                     mDb.insertTile(
                         mNextTileId, worldspace, tilePosition, TileVersion{ version }, input, serialize(data));
                     ++mNextTileId;
@@ -161,7 +162,6 @@ namespace NavMeshTool
             void update(std::string_view worldspace, const TilePosition& tilePosition, std::int64_t tileId,
                 std::int64_t version, PreparedNavMeshData& data) override
             {
-                data.mUserId = static_cast<unsigned>(tileId);
                 {
                     std::lock_guard lock(mMutex);
                     if (mRemoveUnusedTiles)
@@ -217,6 +217,52 @@ namespace NavMeshTool
                 mDb.vacuum();
             }
 
+            void migrateTileData()
+            {
+                constexpr std::size_t batchSize = 1000;
+                const std::lock_guard lock(mMutex);
+                std::size_t migrated = 0;
+                while (const std::size_t number = mDb.migrateTileData(batchSize))
+                {
+                    migrated += number;
+                    mTransaction.commit();
+                    mTransaction = mDb.startTransaction(Sqlite3::TransactionMode::Immediate);
+                }
+                if (migrated > 0)
+                    Log(Debug::Info) << "Moved data of " << migrated << " tiles into shared storage";
+            }
+
+            void updateCellFingerprints(const std::vector<DetourNavigator::CellFingerprint>& cells,
+                const std::vector<DetourNavigator::CellFingerprint>& removedCells)
+            {
+                const std::lock_guard lock(mMutex);
+                mTransaction = mDb.startTransaction(Sqlite3::TransactionMode::Immediate);
+                for (const DetourNavigator::CellFingerprint& v : cells)
+                    mDb.setCellFingerprint(v);
+                for (const DetourNavigator::CellFingerprint& v : removedCells)
+                    mDb.deleteCellFingerprint(v.mWorldspace, v.mCellPosition);
+                mTransaction.commit();
+            }
+
+            std::size_t deleteUnusedTileData()
+            {
+                const std::lock_guard lock(mMutex);
+                return static_cast<std::size_t>(mDb.deleteUnusedTileData());
+            }
+
+            DetourNavigator::TileDataStats getTileDataStats()
+            {
+                const std::lock_guard lock(mMutex);
+                return mDb.getTileDataStats();
+            }
+
+            void removeTiles(std::string_view worldspace)
+            {
+                const std::lock_guard lock(mMutex);
+                Log(Debug::Info) << "Removing tiles for removed worldspace \"" << worldspace << "\"...";
+                mDeleted += static_cast<std::size_t>(mDb.deleteTiles(worldspace));
+            }
+
             void removeTilesOutsideRange(std::string_view worldspace, const TilesPositionsRange& range)
             {
                 const std::lock_guard lock(mMutex);
@@ -262,21 +308,34 @@ namespace NavMeshTool
         SceneUtil::WorkQueue workQueue(threadsNumber);
         auto navMeshTileConsumer
             = std::make_shared<NavMeshTileConsumer>(std::move(db), removeUnusedTiles, writeBinaryLog);
+        navMeshTileConsumer->migrateTileData();
+        const auto start = std::chrono::steady_clock::now();
         std::size_t tiles = 0;
         std::mt19937_64 random;
 
+        if (removeUnusedTiles)
+            for (const std::string& worldspace : data.mRemovedWorldspaces)
+                navMeshTileConsumer->removeTiles(worldspace);
+
         for (const std::unique_ptr<WorldspaceNavMeshInput>& input : data.mNavMeshInputs)
         {
-            const auto range = DetourNavigator::makeTilesPositionsRange(Misc::Convert::toOsgXY(input->mAabb.m_min),
-                Misc::Convert::toOsgXY(input->mAabb.m_max), settings.mRecast);
+            std::vector<TilePosition> worldspaceTiles;
 
-            if (removeUnusedTiles)
-                navMeshTileConsumer->removeTilesOutsideRange(input->mWorldspace, range);
+            if (input->mPartial)
+            {
+                worldspaceTiles = input->mChangedTiles;
+            }
+            else
+            {
+                const auto range = DetourNavigator::makeTilesPositionsRange(Misc::Convert::toOsgXY(input->mAabb.m_min),
+                    Misc::Convert::toOsgXY(input->mAabb.m_max), settings.mRecast);
 
-            std::vector<TilePosition> worldspaceTiles;
+                if (removeUnusedTiles)
+                    navMeshTileConsumer->removeTilesOutsideRange(input->mWorldspace, range);
 
-            DetourNavigator::getTilesPositions(
-                range, [&](const TilePosition& tilePosition) { worldspaceTiles.push_back(tilePosition); });
+                DetourNavigator::getTilesPositions(
+                    range, [&](const TilePosition& tilePosition) { worldspaceTiles.push_back(tilePosition); });
+            }
 
             tiles += worldspaceTiles.size();
 
@@ -295,21 +354,38 @@ namespace NavMeshTool
 
         const Status status = navMeshTileConsumer->wait();
         if (status == Status::Ok)
+        {
             navMeshTileConsumer->commit();
+            navMeshTileConsumer->updateCellFingerprints(data.mCellFingerprints, data.mRemovedCells);
+        }
 
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        const auto provided = navMeshTileConsumer->getProvided();
         const auto inserted = navMeshTileConsumer->getInserted();
         const auto updated = navMeshTileConsumer->getUpdated();
         const auto deleted = navMeshTileConsumer->getDeleted();
 
-        Log(Debug::Info) << "Generated navmesh for " << navMeshTileConsumer->getProvided() << " tiles, " << inserted
-                         << " are inserted, " << updated << " updated and " << deleted << " deleted";
+        Log(Debug::Info) << "Generated navmesh for " << provided << " tiles, " << inserted << " are inserted, "
+                         << updated << " updated and " << deleted << " deleted in " << duration.count() << " s ("
+                         << (duration.count() > 0 ? static_cast<double>(provided) / duration.count() : 0.0)
+                         << " tiles/s)";
 
         if (inserted + updated + deleted > 0)
         {
+            if (status == Status::Ok)
+            {
+                const std::size_t deletedData = navMeshTileConsumer->deleteUnusedTileData();
+                Log(Debug::Info) << "Removed " << deletedData << " unused tile data";
+            }
             Log(Debug::Info) << "Vacuuming the database...";
             navMeshTileConsumer->vacuum();
         }
 
+        const DetourNavigator::TileDataStats stats = navMeshTileConsumer->getTileDataStats();
+        Log(Debug::Info) << "Database contains " << stats.mTiles << " tiles sharing " << stats.mTileData
+                         << " unique tile data of " << stats.mTileDataSize << " compressed bytes, file size is "
+                         << stats.mFileSize << " bytes";
+
         return status;
     }
 }
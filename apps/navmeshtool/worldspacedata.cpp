@@ -3,10 +3,12 @@
 #include <components/bullethelpers/aabb.hpp>
 #include <components/debug/debugging.hpp>
 #include <components/debug/debuglog.hpp>
+#include <components/detournavigator/changedcells.hpp>
 #include <components/detournavigator/debug.hpp>
 #include <components/detournavigator/gettilespositions.hpp>
 #include <components/detournavigator/objectid.hpp>
 #include <components/detournavigator/recastmesh.hpp>
+#include <components/detournavigator/serialization.hpp>
 #include <components/detournavigator/settings.hpp>
 #include <components/detournavigator/tilecachedrecastmeshmanager.hpp>
 #include <components/esm/refid.hpp>
@@ -26,18 +28,24 @@
 #include <components/settings/settings.hpp>
 #include <components/vfs/manager.hpp>
 
+#include <extern/smhasher/MurmurHash3.h>
+
 #include <LinearMath/btVector3.h>
 
 #include <osg/Vec2i>
 #include <osg/ref_ptr>
 
 #include <algorithm>
+#include <array>
+#include <map>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -216,6 +224,98 @@ namespace NavMeshTool
             return { surface, landData.mMinHeight, landData.mMaxHeight };
         }
 
+        using DetourNavigator::CellKey;
+        using DetourNavigator::TilePosition;
+        using DetourNavigator::TilesPositionsRange;
+
+        enum class CellState
+        {
+            Skipped,
+            Unchanged,
+            Changed,
+        };
+
+        std::string getCellWorldspace(const ESM::Cell& cell)
+        {
+            return Misc::StringUtils::lowerCase(
+                (cell.isExterior() ? ESM::Cell::sDefaultWorldspaceId : cell.mId).serializeText());
+        }
+
+        template <class T>
+        void appendBytes(const T& value, std::vector<std::byte>& buffer)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const std::byte* const begin = reinterpret_cast<const std::byte*>(&value);
+            buffer.insert(buffer.end(), begin, begin + sizeof(T));
+        }
+
+        void appendBytes(std::string_view value, std::vector<std::byte>& buffer)
+        {
+            appendBytes(value.size(), buffer);
+            const std::byte* const begin = reinterpret_cast<const std::byte*>(value.data());
+            buffer.insert(buffer.end(), begin, begin + value.size());
+        }
+
+        // Tiles generated with different settings or format can't be reused so these are a part of every fingerprint
+        std::vector<std::byte> makeInputKey(
+            const DetourNavigator::RecastSettings& settings, const DetourNavigator::AgentBounds& agentBounds)
+        {
+            std::vector<std::byte> result = DetourNavigator::serialize(settings, agentBounds);
+            appendBytes(DetourNavigator::navMeshFormatVersion, result);
+            return result;
+        }
+
+        // Covers everything the cell adds to the navmesh input except the content of the model files
+        std::vector<std::byte> makeCellFingerprint(const ESM::Cell& cell, const osg::Vec2i& cellPosition,
+            const EsmLoader::EsmData& esmData, ESM::ReadersCache& readers, const std::vector<std::byte>& inputKey)
+        {
+            std::vector<std::byte> buffer = inputKey;
+
+            appendBytes(cell.isExterior(), buffer);
+
+            if (cell.isExterior())
+            {
+                const auto it
+                    = std::lower_bound(esmData.mLands.begin(), esmData.mLands.end(), cellPosition, LessByXY{});
+                if (it != esmData.mLands.end() && GetXY{}(*it) == cellPosition
+                    && (it->mDataTypes & ESM::Land::DATA_VHGT) != 0)
+                {
+                    ESM::Land::LandData landData;
+                    it->loadData(ESM::Land::DATA_VHGT, landData);
+                    appendBytes(landData.mHeights, buffer);
+                }
+            }
+            else
+            {
+                appendBytes(cell.mData.mFlags & ESM::Cell::HasWater, buffer);
+                appendBytes(cell.mWater, buffer);
+            }
+
+            for (const CellRef& cellRef : loadCellRefs(cell, esmData, readers))
+            {
+                switch (cellRef.mType)
+                {
+                    case ESM::REC_ACTI:
+                    case ESM::REC_CONT:
+                    case ESM::REC_DOOR:
+                    case ESM::REC_STAT:
+                        appendBytes(cellRef.mType, buffer);
+                        appendBytes(getModel(esmData, cellRef.mRefId, cellRef.mType), buffer);
+                        appendBytes(cellRef.mPos, buffer);
+                        appendBytes(cellRef.mScale, buffer);
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            const std::array<std::uint64_t, 2> seed{ 0, 0 };
+            std::array<std::uint64_t, 2> hash{ 0, 0 };
+            MurmurHash3_x64_128(buffer.data(), static_cast<int>(buffer.size()), seed.data(), hash.data());
+            const std::byte* const begin = reinterpret_cast<const std::byte*>(hash.data());
+            return std::vector<std::byte>(begin, begin + sizeof(hash));
+        }
+
         template <class T>
         void serializeToStderr(const T& value)
         {
@@ -243,9 +343,10 @@ namespace NavMeshTool
         mAabb.m_max = btVector3(0, 0, 0);
     }
 
-    WorldspaceData gatherWorldspaceData(const DetourNavigator::Settings& settings, ESM::ReadersCache& readers,
-        const VFS::Manager& vfs, Resource::BulletShapeManager& bulletShapeManager, const EsmLoader::EsmData& esmData,
-        bool processInteriorCells, bool writeBinaryLog)
+    WorldspaceData gatherWorldspaceData(const DetourNavigator::Settings& settings,
+        const DetourNavigator::AgentBounds& agentBounds, ESM::ReadersCache& readers, const VFS::Manager& vfs,
+        Resource::BulletShapeManager& bulletShapeManager, const EsmLoader::EsmData& esmData, bool processInteriorCells,
+        bool writeBinaryLog, const std::vector<DetourNavigator::CellFingerprint>* previousCellFingerprints)
     {
         Log(Debug::Info) << "Processing " << esmData.mCells.size() << " cells...";
 
@@ -254,43 +355,104 @@ namespace NavMeshTool
 
         std::size_t objectsCounter = 0;
 
-        if (writeBinaryLog)
-            serializeToStderr(ExpectedCells{ static_cast<std::uint64_t>(esmData.mCells.size()) });
+        const auto getNavMeshInput = [&](const std::string& worldspace) -> WorldspaceNavMeshInput& {
+            auto it = navMeshInputs.find(worldspace);
+            if (it == navMeshInputs.end())
+            {
+                auto navMeshInput = std::make_unique<WorldspaceNavMeshInput>(worldspace, settings.mRecast);
+                const std::string_view key = navMeshInput->mWorldspace;
+                it = navMeshInputs.emplace(key, std::move(navMeshInput)).first;
+                it->second->mTileCachedRecastMeshManager.setWorldspace(worldspace, nullptr);
+            }
+            return *it->second;
+        };
+
+        const std::string defaultWorldspace
+            = Misc::StringUtils::lowerCase(ESM::Cell::sDefaultWorldspaceId.serializeText());
+        const std::vector<std::byte> inputKey = makeInputKey(settings.mRecast, agentBounds);
+        std::vector<CellState> cellStates(esmData.mCells.size(), CellState::Skipped);
+        // Index in data.mCellFingerprints for each not skipped cell
+        std::vector<std::size_t> fingerprintIndices(esmData.mCells.size(), 0);
+        std::set<CellKey> cellKeys;
 
         for (std::size_t i = 0; i < esmData.mCells.size(); ++i)
         {
             const ESM::Cell& cell = esmData.mCells[i];
-            const bool exterior = cell.isExterior();
+            const osg::Vec2i cellPosition(cell.mData.mX, cell.mData.mY);
+            std::string cellWorldspace = getCellWorldspace(cell);
+            cellKeys.emplace(cellWorldspace, cellPosition.x(), cellPosition.y());
+            if (!cell.isExterior() && !processInteriorCells)
+                continue;
+            fingerprintIndices[i] = data.mCellFingerprints.size();
+            data.mCellFingerprints.push_back(DetourNavigator::CellFingerprint{ std::move(cellWorldspace),
+                cellPosition, makeCellFingerprint(cell, cellPosition, esmData, readers, inputKey), {} });
+            cellStates[i] = CellState::Changed;
+        }
+
+        // Tiles affected by changed and removed exterior cells. Previous tiles ranges are included because content
+        // of these tiles has to be regenerated without the objects that are not there anymore.
+        std::vector<TilesPositionsRange> changedRanges;
+
+        if (previousCellFingerprints != nullptr)
+        {
+            DetourNavigator::CellsChanges changes
+                = DetourNavigator::getCellsChanges(data.mCellFingerprints, *previousCellFingerprints, cellKeys);
 
-            if (!exterior && !processInteriorCells)
+            std::size_t changed = 0;
+            for (std::size_t i = 0; i < esmData.mCells.size(); ++i)
             {
-                if (writeBinaryLog)
-                    serializeToStderr(ProcessedCells{ static_cast<std::uint64_t>(i + 1) });
-                Log(Debug::Info) << "Skipped interior"
-                                 << " cell (" << (i + 1) << "/" << esmData.mCells.size() << ") \""
-                                 << cell.getDescription() << "\"";
-                continue;
+                if (cellStates[i] == CellState::Skipped)
+                    continue;
+                const DetourNavigator::CellChange& change = changes.mCells[fingerprintIndices[i]];
+                if (!change.mChanged)
+                {
+                    cellStates[i] = CellState::Unchanged;
+                    data.mCellFingerprints[fingerprintIndices[i]].mTilesRange = *change.mPreviousTilesRange;
+                    continue;
+                }
+                ++changed;
+                if (esmData.mCells[i].isExterior() && change.mPreviousTilesRange.has_value())
+                    changedRanges.push_back(*change.mPreviousTilesRange);
             }
 
+            data.mRemovedCells = std::move(changes.mRemovedCells);
+            data.mRemovedWorldspaces = std::move(changes.mRemovedWorldspaces);
+
+            Log(Debug::Info) << "Found " << changed << " changed and " << data.mRemovedCells.size()
+                             << " removed cells, " << data.mRemovedWorldspaces.size() << " removed worldspaces";
+
+            for (const DetourNavigator::CellFingerprint& v : data.mRemovedCells)
+                if (v.mWorldspace == defaultWorldspace)
+                    changedRanges.push_back(v.mTilesRange);
+        }
+
+        if (writeBinaryLog)
+            serializeToStderr(ExpectedCells{ static_cast<std::uint64_t>(esmData.mCells.size()) });
+
+        std::size_t processedCells = 0;
+
+        const auto reportProcessedCell = [&] {
+            ++processedCells;
+            if (writeBinaryLog)
+                serializeToStderr(ProcessedCells{ static_cast<std::uint64_t>(processedCells) });
+        };
+
+        const auto processCell = [&](std::size_t i) {
+            const ESM::Cell& cell = esmData.mCells[i];
+            const bool exterior = cell.isExterior();
+
             Log(Debug::Debug) << "Processing " << (exterior ? "exterior" : "interior") << " cell (" << (i + 1) << "/"
                               << esmData.mCells.size() << ") \"" << cell.getDescription() << "\"";
 
             const osg::Vec2i cellPosition(cell.mData.mX, cell.mData.mY);
             const std::size_t cellObjectsBegin = data.mObjects.size();
-            const auto cellWorldspace = Misc::StringUtils::lowerCase(
-                (cell.isExterior() ? ESM::Cell::sDefaultWorldspaceId : cell.mId).serializeText());
-            WorldspaceNavMeshInput& navMeshInput = [&]() -> WorldspaceNavMeshInput& {
-                auto it = navMeshInputs.find(cellWorldspace);
-                if (it == navMeshInputs.end())
-                {
-                    it = navMeshInputs
-                             .emplace(cellWorldspace,
-                                 std::make_unique<WorldspaceNavMeshInput>(cellWorldspace, settings.mRecast))
-                             .first;
-                    it->second->mTileCachedRecastMeshManager.setWorldspace(cellWorldspace, nullptr);
-                }
-                return *it->second;
-            }();
+            WorldspaceNavMeshInput& navMeshInput = getNavMeshInput(getCellWorldspace(cell));
+            // Covers everything the cell adds to the navmesh input to find the tiles it affects
+            btAABB cellArea;
+            bool cellAreaInitialized = false;
+
+            if (previousCellFingerprints != nullptr && exterior)
+                navMeshInput.mPartial = true;
 
             const auto guard = navMeshInput.mTileCachedRecastMeshManager.makeUpdateGuard();
 
@@ -302,8 +464,9 @@ namespace NavMeshTool
                     = makeHeightfieldShape(it == esmData.mLands.end() ? std::optional<ESM::Land>() : *it, cellPosition,
                         data.mHeightfields, data.mLandData);
 
-                mergeOrAssign(
-                    getAabb(cellPosition, minHeight, maxHeight), navMeshInput.mAabb, navMeshInput.mAabbInitialized);
+                const btAABB cellAabb = getAabb(cellPosition, minHeight, maxHeight);
+                mergeOrAssign(cellAabb, navMeshInput.mAabb, navMeshInput.mAabbInitialized);
+                mergeOrAssign(cellAabb, cellArea, cellAreaInitialized);
 
                 navMeshInput.mTileCachedRecastMeshManager.addHeightfield(
                     cellPosition, ESM::Land::REAL_SIZE, heightfieldShape, guard.get());
@@ -324,9 +487,13 @@ namespace NavMeshTool
                 const btTransform& transform = object.getCollisionObject().getWorldTransform();
                 const btAABB aabb = BulletHelpers::getAabb(*object.getCollisionObject().getCollisionShape(), transform);
                 mergeOrAssign(aabb, navMeshInput.mAabb, navMeshInput.mAabbInitialized);
+                mergeOrAssign(aabb, cellArea, cellAreaInitialized);
                 if (const btCollisionShape* avoid = object.getShapeInstance()->mAvoidCollisionShape.get())
-                    navMeshInput.mAabb.merge(BulletHelpers::getAabb(*avoid, transform));
-
+                {
+                    const btAABB avoidAabb = BulletHelpers::getAabb(*avoid, transform);
+                    navMeshInput.mAabb.merge(avoidAabb);
+                    cellArea.merge(avoidAabb);
+                }
                 const ObjectId objectId(++objectsCounter);
                 const CollisionShape shape(object.getShapeInstance(), *object.getCollisionObject().getCollisionShape(),
                     object.getObjectTransform());
@@ -349,14 +516,76 @@ namespace NavMeshTool
                 data.mObjects.emplace_back(std::move(object));
             });
 
-            const auto cellDescription = cell.getDescription();
+            if (cellAreaInitialized)
+                data.mCellFingerprints[fingerprintIndices[i]].mTilesRange
+                    = DetourNavigator::makeTilesPositionsRange(Misc::Convert::toOsgXY(cellArea.m_min),
+                        Misc::Convert::toOsgXY(cellArea.m_max), settings.mRecast);
 
-            if (writeBinaryLog)
-                serializeToStderr(ProcessedCells{ static_cast<std::uint64_t>(i + 1) });
+            reportProcessedCell();
 
             Log(Debug::Info) << "Processed " << (exterior ? "exterior" : "interior") << " cell (" << (i + 1) << "/"
-                             << esmData.mCells.size() << ") " << cellDescription << " with "
+                             << esmData.mCells.size() << ") " << cell.getDescription() << " with "
                              << (data.mObjects.size() - cellObjectsBegin) << " objects";
+        };
+
+        for (std::size_t i = 0; i < esmData.mCells.size(); ++i)
+        {
+            const ESM::Cell& cell = esmData.mCells[i];
+
+            switch (cellStates[i])
+            {
+                case CellState::Skipped:
+                    reportProcessedCell();
+                    Log(Debug::Info) << "Skipped interior"
+                                     << " cell (" << (i + 1) << "/" << esmData.mCells.size() << ") \""
+                                     << cell.getDescription() << "\"";
+                    break;
+                case CellState::Unchanged:
+                    // Unchanged exterior cells are loaded after all changed cells when changed tiles are known
+                    if (cell.isExterior())
+                        break;
+                    reportProcessedCell();
+                    Log(Debug::Debug) << "Skipped unchanged interior cell (" << (i + 1) << "/"
+                                      << esmData.mCells.size() << ") \"" << cell.getDescription() << "\"";
+                    break;
+                case CellState::Changed:
+                    processCell(i);
+                    if (previousCellFingerprints != nullptr && cell.isExterior())
+                        changedRanges.push_back(data.mCellFingerprints[fingerprintIndices[i]].mTilesRange);
+                    break;
+            }
+        }
+
+        if (previousCellFingerprints != nullptr)
+        {
+            std::vector<TilePosition> changedTiles = DetourNavigator::getTilesPositions(changedRanges);
+
+            Log(Debug::Info) << "Found " << changedTiles.size() << " changed tiles";
+
+            // Objects from any unchanged cell may overlap changed tiles so such cells are required to generate them
+            for (std::size_t i = 0; i < esmData.mCells.size(); ++i)
+            {
+                if (cellStates[i] != CellState::Unchanged || !esmData.mCells[i].isExterior())
+                    continue;
+
+                if (DetourNavigator::hasTilesPositionsInRange(
+                        changedTiles, data.mCellFingerprints[fingerprintIndices[i]].mTilesRange))
+                {
+                    processCell(i);
+                    continue;
+                }
+
+                reportProcessedCell();
+                Log(Debug::Debug) << "Skipped unchanged exterior cell (" << (i + 1) << "/" << esmData.mCells.size()
+                                  << ") \"" << esmData.mCells[i].getDescription() << "\"";
+            }
+
+            if (!changedTiles.empty())
+            {
+                WorldspaceNavMeshInput& navMeshInput = getNavMeshInput(defaultWorldspace);
+                navMeshInput.mPartial = true;
+                navMeshInput.mChangedTiles = std::move(changedTiles);
+            }
         }
 
         data.mNavMeshInputs.reserve(navMeshInputs.size());
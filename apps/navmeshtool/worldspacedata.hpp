@@ -2,7 +2,9 @@
 #define OPENMW_NAVMESHTOOL_WORLDSPACEDATA_H
 
 #include <components/bullethelpers/collisionobject.hpp>
+#include <components/detournavigator/navmeshdb.hpp>
 #include <components/detournavigator/tilecachedrecastmeshmanager.hpp>
+#include <components/detournavigator/tileposition.hpp>
 #include <components/esm3/loadland.hpp>
 #include <components/misc/convert.hpp>
 #include <components/resource/bulletshape.hpp>
@@ -39,6 +41,7 @@ namespace EsmLoader
 namespace DetourNavigator
 {
     struct Settings;
+    struct AgentBounds;
 }
 
 namespace NavMeshTool
@@ -52,6 +55,10 @@ namespace NavMeshTool
         TileCachedRecastMeshManager mTileCachedRecastMeshManager;
         btAABB mAabb;
         bool mAabbInitialized = false;
+        // Set when only changed cells and the cells affecting the same tiles are loaded, then only mChangedTiles
+        // have to be generated
+        bool mPartial = false;
+        std::vector<DetourNavigator::TilePosition> mChangedTiles;
 
         explicit WorldspaceNavMeshInput(std::string worldspace, const DetourNavigator::RecastSettings& settings);
     };
@@ -86,11 +93,17 @@ namespace NavMeshTool
         std::vector<BulletObject> mObjects;
         std::vector<std::unique_ptr<ESM::Land::LandData>> mLandData;
         std::vector<std::vector<float>> mHeightfields;
+        std::vector<DetourNavigator::CellFingerprint> mCellFingerprints;
+        std::vector<DetourNavigator::CellFingerprint> mRemovedCells;
+        std::vector<std::string> mRemovedWorldspaces;
     };
 
-    WorldspaceData gatherWorldspaceData(const DetourNavigator::Settings& settings, ESM::ReadersCache& readers,
-        const VFS::Manager& vfs, Resource::BulletShapeManager& bulletShapeManager, const EsmLoader::EsmData& esmData,
-        bool processInteriorCells, bool writeBinaryLog);
+    // When previousCellFingerprints is not null only cells with different fingerprint and the cells affecting any of
+    // the tiles affected by the changed or removed cells are loaded
+    WorldspaceData gatherWorldspaceData(const DetourNavigator::Settings& settings,
+        const DetourNavigator::AgentBounds& agentBounds, ESM::ReadersCache& readers, const VFS::Manager& vfs,
+        Resource::BulletShapeManager& bulletShapeManager, const EsmLoader::EsmData& esmData, bool processInteriorCells,
+        bool writeBinaryLog, const std::vector<DetourNavigator::CellFingerprint>* previousCellFingerprints);
 }
 
 #endif
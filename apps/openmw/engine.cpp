@@ -671,7 +671,7 @@ void OMW::Engine::prepareEngine()
     mL10nManager->setPreferredLocales(Settings::general().mPreferredLocales, Settings::general().mGmstOverridesL10n);
     mEnvironment.setL10nManager(*mL10nManager);
 
-    mLuaManager = std::make_unique<MWLua::LuaManager>(mVFS.get(), mResDir / "lua_libs");
+    mLuaManager = std::make_unique<MWLua::LuaManager>(mVFS.get(), mResDir / "lua_libs", mCfgMgr.getCachePath());
     mEnvironment.setLuaManager(*mLuaManager);
 
     // Create input and UI first to set up a bootstrapping environment for
@@ -946,9 +946,6 @@ void OMW::Engine::go()
             std::this_thread::sleep_for(std::chrono::milliseconds(5));
             continue;
         }
-        timeManager.updateIsPaused();
-        if (!timeManager.isPaused())
-            timeManager.setSimulationTime(timeManager.getSimulationTime() + dt);
 
         if (stats)
         {
@@ -966,6 +963,13 @@ void OMW::Engine::go()
         }
 
         frameRateLimiter.limit();
+
+        // With "lua pipelined update" the Lua thread may still be running here
+        mLuaWorker->waitForUpdate();
+
+        timeManager.updateIsPaused();
+        if (!timeManager.isPaused())
+            timeManager.setSimulationTime(timeManager.getSimulationTime() + dt);
     }
 
     mLuaWorker->join();
@@ -974,6 +978,7 @@ void OMW::Engine::go()
     Settings::Manager::saveUser(mCfgMgr.getUserConfigPath() / "settings.cfg");
     Settings::ShaderManager::get().save();
     mLuaManager->savePermanentStorage(mCfgMgr.getUserConfigPath());
+    mLuaManager->writeSampledStacks(mCfgMgr.getLogPath());
 
     Log(Debug::Info) << "Quitting peacefully.";
 }
@@ -109,12 +109,35 @@ namespace MWLua
         MWWorld::WorldModel* mWorldModel = MWBase::Environment::get().getWorldModel();
     };
 
+    void EngineEvents::clear()
+    {
+        mQueue.clear();
+        mTeleported.clear();
+    }
+
+    void EngineEvents::addToQueue(Event e)
+    {
+        // An object can be moved several times per frame, but `onTeleported` should be called only once.
+        // The order matters only relatively to activation and deactivation of the object.
+        if (const auto* event = std::get_if<OnTeleported>(&e))
+        {
+            if (!mTeleported.insert(event->mObject).second)
+                return;
+        }
+        else if (const auto* event = std::get_if<OnActive>(&e))
+            mTeleported.erase(event->mObject);
+        else if (const auto* event = std::get_if<OnInactive>(&e))
+            mTeleported.erase(event->mObject);
+        mQueue.push_back(std::move(e));
+    }
+
     void EngineEvents::callEngineHandlers()
     {
         Visitor vis(mGlobalScripts);
         for (const Event& event : mQueue)
             std::visit(vis, event);
         mQueue.clear();
+        mTeleported.clear();
     }
 
 }
@@ -1,6 +1,7 @@
 #ifndef MWLUA_ENGINEEVENTS_H
 #define MWLUA_ENGINEEVENTS_H
 
+#include <set>
 #include <variant>
 
 #include <components/esm3/cellref.hpp> // defines RefNum that is used as a unique id
@@ -52,8 +53,8 @@ namespace MWLua
         };
         using Event = std::variant<OnActive, OnInactive, OnConsume, OnActivate, OnUseItem, OnNewExterior, OnTeleported>;
 
-        void clear() { mQueue.clear(); }
-        void addToQueue(Event e) { mQueue.push_back(std::move(e)); }
+        void clear();
+        void addToQueue(Event e);
         void callEngineHandlers();
 
     private:
@@ -61,6 +62,8 @@ namespace MWLua
 
         GlobalScripts& mGlobalScripts;
         std::vector<Event> mQueue;
+        // Objects that already have OnTeleported in the queue and were not (de)activated after it.
+        std::set<ESM::RefNum> mTeleported;
     };
 
 }
@@ -1,5 +1,7 @@
 #include "luaevents.hpp"
 
+#include <algorithm>
+
 #include <components/debug/debuglog.hpp>
 
 #include <components/esm/luascripts.hpp>
@@ -38,15 +40,24 @@ namespace MWLua
         for (const Global& e : mGlobalEventBatch)
             mGlobalScripts.receiveEvent(e.mEventName, e.mEventData);
         mGlobalEventBatch.clear();
-        for (const Local& e : mLocalEventBatch)
+
+        const MWWorld::WorldModel& worldModel = *MWBase::Environment::get().getWorldModel();
+        for (auto it = mLocalEventBatch.begin(); it != mLocalEventBatch.end();)
         {
-            MWWorld::Ptr ptr = MWBase::Environment::get().getWorldModel()->getPtr(e.mDest);
+            // Events sent to the same object one after another are delivered together.
+            const ESM::RefNum dest = it->mDest;
+            const auto batchEnd
+                = std::find_if(it, mLocalEventBatch.end(), [&](const Local& e) { return !(e.mDest == dest); });
+            MWWorld::Ptr ptr = worldModel.getPtr(dest);
             LocalScripts* scripts = ptr.isEmpty() ? nullptr : ptr.getRefData().getLuaScripts();
-            if (scripts)
-                scripts->receiveEvent(e.mEventName, e.mEventData);
-            else
-                Log(Debug::Debug) << "Ignored event " << e.mEventName << " to L" << e.mDest.toString()
-                                  << ". Object not found or has no attached scripts";
+            for (; it != batchEnd; ++it)
+            {
+                if (scripts)
+                    scripts->receiveEvent(it->mEventName, it->mEventData);
+                else
+                    Log(Debug::Debug) << "Ignored event " << it->mEventName << " to L" << dest.toString()
+                                      << ". Object not found or has no attached scripts";
+            }
         }
         mLocalEventBatch.clear();
     }
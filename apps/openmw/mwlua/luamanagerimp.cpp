@@ -1,6 +1,8 @@
 #include "luamanagerimp.hpp"
 
+#include <chrono>
 #include <filesystem>
+#include <fstream>
 
 #include <MyGUI_InputManager.h>
 #include <osg/Stats>
@@ -12,12 +14,14 @@
 #include <components/esm/luascripts.hpp>
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/esmwriter.hpp>
+#include <components/files/conversion.hpp>
 
 #include <components/settings/values.hpp>
 
 #include <components/l10n/manager.hpp>
 
 #include <components/lua_ui/content.hpp>
+#include <components/lua_ui/element.hpp>
 #include <components/lua_ui/util.hpp>
 
 #include "../mwbase/windowmanager.hpp"
@@ -38,21 +42,24 @@
 namespace MWLua
 {
 
-    static LuaUtil::LuaStateSettings createLuaStateSettings()
+    static LuaUtil::LuaStateSettings createLuaStateSettings(const std::filesystem::path& cachePath)
     {
         if (!Settings::lua().mLuaProfiler)
             LuaUtil::LuaState::disableProfiler();
         return { .mInstructionLimit = Settings::lua().mInstructionLimitPerCall,
             .mMemoryLimit = Settings::lua().mMemoryLimit,
             .mSmallAllocMaxSize = Settings::lua().mSmallAllocMaxSize,
-            .mLogMemoryUsage = Settings::lua().mLogMemoryUsage };
+            .mLogMemoryUsage = Settings::lua().mLogMemoryUsage,
+            .mBytecodeCachePath = Settings::lua().mBytecodeCache ? cachePath / "lua" : std::filesystem::path() };
     }
 
-    LuaManager::LuaManager(const VFS::Manager* vfs, const std::filesystem::path& libsDir)
-        : mLua(vfs, &mConfiguration, createLuaStateSettings())
+    LuaManager::LuaManager(
+        const VFS::Manager* vfs, const std::filesystem::path& libsDir, const std::filesystem::path& cachePath)
+        : mLua(vfs, &mConfiguration, createLuaStateSettings(cachePath))
     {
         Log(Debug::Info) << "Lua version: " << LuaUtil::getLuaVersion();
         mLua.addInternalLibSearchPath(libsDir);
+        mLua.removeStaleBytecodeCacheFiles();
 
         mGlobalSerializer = createUserdataSerializer(false);
         mLocalSerializer = createUserdataSerializer(true);
@@ -60,6 +67,8 @@ namespace MWLua
         mLocalLoader = createUserdataSerializer(true, &mContentFileMapping);
 
         mGlobalScripts.setSerializer(mGlobalSerializer.get());
+
+        mLua.setSamplingEnabled(Settings::lua().mLuaSamplingProfiler);
     }
 
     void LuaManager::initConfiguration()
@@ -73,6 +82,8 @@ namespace MWLua
 
     void LuaManager::init()
     {
+        const auto start = std::chrono::steady_clock::now();
+
         Context context;
         context.mIsGlobal = true;
         context.mLuaManager = this;
@@ -103,6 +114,11 @@ namespace MWLua
 
         initConfiguration();
         mInitialized = true;
+
+        const auto finish = std::chrono::steady_clock::now();
+        Log(Debug::Info) << "Lua initialized in "
+                         << std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(finish - start).count()
+                         << "ms";
     }
 
     void LuaManager::loadPermanentStorage(const std::filesystem::path& userConfigPath)
@@ -121,6 +137,21 @@ namespace MWLua
         mPlayerStorage.save(userConfigPath / "player_storage.bin");
     }
 
+    void LuaManager::writeSampledStacks(const std::filesystem::path& logPath) const
+    {
+        if (!mLua.isSamplingEnabled())
+            return;
+        const std::filesystem::path path = logPath / "lua_profile.folded";
+        std::ofstream stream(path);
+        if (!stream)
+        {
+            Log(Debug::Error) << "Failed to write Lua profile to " << Files::pathToUnicodeString(path);
+            return;
+        }
+        mLua.writeSampledStacks(stream);
+        Log(Debug::Info) << "Lua profile is written to " << Files::pathToUnicodeString(path);
+    }
+
     void LuaManager::update()
     {
         if (Settings::lua().mGcStepsPerFrame > 0)
@@ -147,6 +178,8 @@ namespace MWLua
         mGlobalScripts.statsNextFrame();
         for (LocalScripts* scripts : mActiveLocalScripts)
             scripts->statsNextFrame();
+        if (mLua.isSamplingEnabled())
+            mLua.samplingNextFrame();
 
         mLuaEvents.finalizeEventBatch();
 
@@ -239,6 +272,17 @@ namespace MWLua
         mInGameConsoleMessages.clear();
 
         applyDelayedActions();
+
+        // UI elements are created and updated by the delayed actions
+        const LuaUi::Element::UpdateStats uiStats = LuaUi::Element::takeUpdateStats();
+        if (LuaUtil::LuaState::isProfilerEnabled())
+        {
+            constexpr double c = 1.0 / 30; // averaging over approximately 30 frames
+            mUiUpdateCost.mTime = mUiUpdateCost.mTime * (1 - c) + uiStats.mTime * c;
+            mUiUpdateCost.mCreated = mUiUpdateCost.mCreated * (1 - c) + uiStats.mCreated * c;
+            mUiUpdateCost.mUpdated = mUiUpdateCost.mUpdated * (1 - c) + uiStats.mUpdated * c;
+            mUiUpdateCost.mDestroyed = mUiUpdateCost.mDestroyed * (1 - c) + uiStats.mDestroyed * c;
+        }
     }
 
     void LuaManager::applyDelayedActions()
@@ -480,6 +524,7 @@ namespace MWLua
     void LuaManager::reloadAllScripts()
     {
         Log(Debug::Info) << "Reload Lua";
+        const auto start = std::chrono::steady_clock::now();
 
         LuaUi::clearUserInterface();
         MWBase::Environment::get().getWindowManager()->setConsoleMode("");
@@ -508,6 +553,11 @@ namespace MWLua
         }
         for (LocalScripts* scripts : mActiveLocalScripts)
             scripts->setActive(true);
+
+        const auto finish = std::chrono::steady_clock::now();
+        Log(Debug::Info) << "Lua reloaded in "
+                         << std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(finish - start).count()
+                         << "ms";
     }
 
     void LuaManager::handleConsoleCommand(
@@ -686,6 +736,41 @@ namespace MWLua
             out << "\n";
         }
 
+        out << "\n";
+        out << std::left << " " << std::setw(nameW + 2) << "*** UI elements update (per frame)";
+        out << std::right;
+        out << std::setw(valueW) << "ms";
+        out << std::setw(valueW) << "created";
+        out << std::setw(valueW) << "updated";
+        out << std::setw(valueW) << "destroyed";
+        out << "\n";
+        out << std::left << " " << std::setw(nameW) << "[widgets]" << std::right;
+        out << std::setw(valueW + 2) << std::fixed << std::setprecision(3) << mUiUpdateCost.mTime;
+        out << std::setprecision(1);
+        out << std::setw(valueW) << mUiUpdateCost.mCreated;
+        out << std::setw(valueW) << mUiUpdateCost.mUpdated;
+        out << std::setw(valueW) << mUiUpdateCost.mDestroyed;
+        out << "\n";
+
+        if (mLua.isSamplingEnabled())
+        {
+            constexpr std::size_t maxHandlers = 30;
+            out << "\n";
+            out << std::left << " " << std::setw(nameW + 2) << "*** Time per handler (inclusive)";
+            out << std::right << std::setw(valueW) << "ms/frame";
+            out << "\n";
+            const auto handlerTimes = mLua.getHandlerTimes();
+            for (std::size_t i = 0; i < handlerTimes.size() && i < maxHandlers; ++i)
+            {
+                const auto& [name, time] = handlerTimes[i];
+                out << std::left << " " << std::setw(nameW) << name;
+                if (name.size() > nameW)
+                    out << "\n " << std::setw(nameW) << "";
+                out << std::right << std::setw(valueW + 2) << std::fixed << std::setprecision(3) << time;
+                out << "\n";
+            }
+        }
+
         return out.str();
     }
 }
@@ -30,7 +30,8 @@ namespace MWLua
     class LuaManager : public MWBase::LuaManager
     {
     public:
-        LuaManager(const VFS::Manager* vfs, const std::filesystem::path& libsDir);
+        LuaManager(
+            const VFS::Manager* vfs, const std::filesystem::path& libsDir, const std::filesystem::path& cachePath);
         LuaManager(const LuaManager&) = delete;
         LuaManager(LuaManager&&) = delete;
 
@@ -40,6 +41,9 @@ namespace MWLua
         void loadPermanentStorage(const std::filesystem::path& userConfigPath);
         void savePermanentStorage(const std::filesystem::path& userConfigPath);
 
+        // Writes stacks collected by the sampling profiler (see "[Lua] lua sampling profiler" setting).
+        void writeSampledStacks(const std::filesystem::path& logPath) const;
+
         // \brief Executes lua handlers. Defaults to running in parallel with OSG Cull.
         //
         // The OSG Cull is expensive enough that we have "free" time to
@@ -86,6 +90,7 @@ namespace MWLua
             mEngineEvents.addToQueue(EngineEvents::OnNewExterior{ cell });
         }
         void objectTeleported(const MWWorld::Ptr& ptr) override;
+        void objectMoved(const MWWorld::Ptr& ptr) override { mObjectLists.objectMoved(ptr); }
         void questUpdated(const ESM::RefId& questId, int stage) override;
         void uiModeChanged(const MWWorld::Ptr& arg) override;
 
@@ -200,6 +205,16 @@ namespace MWLua
         std::vector<DelayedAction> mActionQueue;
         std::optional<DelayedAction> mTeleportPlayerAction;
         std::vector<std::string> mUIMessages;
+
+        // Averaged cost of UI elements updates per frame, collected only if the Lua profiler is enabled
+        struct UiUpdateCost
+        {
+            double mTime = 0; // in milliseconds
+            double mCreated = 0;
+            double mUpdated = 0;
+            double mDestroyed = 0;
+        };
+        UiUpdateCost mUiUpdateCost;
         std::vector<std::pair<std::string, Misc::Color>> mInGameConsoleMessages;
 
         LuaUtil::LuaStorage mGlobalStorage{ mLua.sol() };
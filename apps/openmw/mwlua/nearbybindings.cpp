@@ -1,5 +1,9 @@
 #include "nearbybindings.hpp"
 
+#include <cmath>
+#include <limits>
+#include <string>
+
 #include <components/detournavigator/navigator.hpp>
 #include <components/detournavigator/navigatorutils.hpp>
 #include <components/lua/luastate.hpp>
@@ -22,6 +26,24 @@ namespace sol
 
 namespace MWLua
 {
+    namespace
+    {
+        // Spatial queries convert coordinates to integer cell indices, so NaN and infinities are not allowed.
+        float checkFinite(float value, std::string_view name)
+        {
+            if (!std::isfinite(value))
+                throw std::runtime_error("Finite number expected as `" + std::string(name) + "`");
+            return value;
+        }
+
+        const osg::Vec3f& checkFinite(const osg::Vec3f& value, std::string_view name)
+        {
+            if (!std::isfinite(value.x()) || !std::isfinite(value.y()) || !std::isfinite(value.z()))
+                throw std::runtime_error("Finite vector expected as `" + std::string(name) + "`");
+            return value;
+        }
+    }
+
     sol::table initNearbyPackage(const Context& context)
     {
         sol::table api(context.mLua->sol(), sol::create);
@@ -138,6 +160,55 @@ namespace MWLua
         api["items"] = LObjectList{ objectLists->getItemsInScene() };
         api["players"] = LObjectList{ objectLists->getPlayers() };
 
+        api["OBJECT_GROUP"]
+            = LuaUtil::makeStrictReadOnly(context.mLua->tableFromPairs<std::string_view, ObjectLists::Group>({
+                { "Activators", ObjectLists::Group_Activators },
+                { "Actors", ObjectLists::Group_Actors },
+                { "Containers", ObjectLists::Group_Containers },
+                { "Doors", ObjectLists::Group_Doors },
+                { "Items", ObjectLists::Group_Items },
+                { "All", ObjectLists::Group_All },
+            }));
+
+        static constexpr auto getFilter = [](const sol::optional<sol::table>& options) {
+            ObjectLists::Filter filter;
+            if (options.has_value())
+            {
+                if (const auto& v = options->get<sol::optional<unsigned>>("groups"))
+                    filter.mGroups = *v;
+                if (const auto& v = options->get<sol::optional<LObject>>("ignore"))
+                    filter.mIgnore = v->id();
+            }
+            return filter;
+        };
+
+        api["findInSphere"] = [objectLists](const osg::Vec3f& center, float radius,
+                                  const sol::optional<sol::table>& options) {
+            return LObjectList{ objectLists->findInSphere(
+                checkFinite(center, "center"), checkFinite(radius, "radius"), getFilter(options)) };
+        };
+        api["findInBox"]
+            = [objectLists](const osg::Vec3f& min, const osg::Vec3f& max, const sol::optional<sol::table>& options) {
+                  return LObjectList{ objectLists->findInBox(
+                      checkFinite(min, "min"), checkFinite(max, "max"), getFilter(options)) };
+              };
+        api["findInCone"] = [objectLists](const osg::Vec3f& apex, const osg::Vec3f& direction, float angle,
+                                float distance, const sol::optional<sol::table>& options) {
+            return LObjectList{ objectLists->findInCone(checkFinite(apex, "apex"), checkFinite(direction, "direction"),
+                checkFinite(angle, "angle"), checkFinite(distance, "distance"), getFilter(options)) };
+        };
+        api["findNearest"]
+            = [objectLists](const osg::Vec3f& position, std::size_t count, const sol::optional<sol::table>& options) {
+                  float maxDistance = std::numeric_limits<float>::infinity();
+                  if (options.has_value())
+                  {
+                      if (const auto& v = options->get<sol::optional<float>>("maxDistance"))
+                          maxDistance = checkFinite(*v, "maxDistance");
+                  }
+                  return LObjectList{ objectLists->findNearest(
+                      checkFinite(position, "position"), count, maxDistance, getFilter(options)) };
+              };
+
         api["NAVIGATOR_FLAGS"]
             = LuaUtil::makeStrictReadOnly(context.mLua->tableFromPairs<std::string_view, DetourNavigator::Flag>({
                 { "Walk", DetourNavigator::Flag_walk },
@@ -53,6 +53,13 @@ namespace sol
 
 namespace MWLua
 {
+    osg::Quat toQuat(const ESM::Position& pos, bool isActor)
+    {
+        if (isActor)
+            return osg::Quat(pos.rot[0], osg::Vec3(-1, 0, 0)) * osg::Quat(pos.rot[2], osg::Vec3(0, 0, -1));
+        else
+            return Misc::Convert::makeOsgQuat(pos.rot);
+    }
 
     namespace
     {
@@ -160,14 +167,6 @@ namespace MWLua
             }
         }
 
-        osg::Quat toQuat(const ESM::Position& pos, bool isActor)
-        {
-            if (isActor)
-                return osg::Quat(pos.rot[0], osg::Vec3(-1, 0, 0)) * osg::Quat(pos.rot[2], osg::Vec3(0, 0, -1));
-            else
-                return Misc::Convert::makeOsgQuat(pos.rot);
-        }
-
         template <class ObjectT>
         void addBasicBindings(sol::usertype<ObjectT>& objectT, const Context& context)
         {
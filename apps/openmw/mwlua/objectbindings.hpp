@@ -1,10 +1,20 @@
 #ifndef MWLUA_OBJECTBINDINGS_H
 #define MWLUA_OBJECTBINDINGS_H
 
+#include <osg/Quat>
+
 #include "context.hpp"
 
+namespace ESM
+{
+    struct Position;
+}
+
 namespace MWLua
 {
+    // Rotation of an object as it is shown to Lua scripts (e.g. `object.rotation`).
+    osg::Quat toQuat(const ESM::Position& pos, bool isActor);
+
     void initObjectBindingsForLocalScripts(const Context&);
     void initObjectBindingsForGlobalScripts(const Context&);
 }
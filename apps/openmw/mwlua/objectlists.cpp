@@ -1,5 +1,8 @@
 #include "objectlists.hpp"
 
+#include <algorithm>
+#include <utility>
+
 #include <components/esm3/esmreader.hpp>
 #include <components/esm3/esmwriter.hpp>
 #include <components/esm3/loadcell.hpp>
@@ -16,7 +19,6 @@
 
 namespace MWLua
 {
-
     void ObjectLists::update()
     {
         mActivatorsInScene.updateList();
@@ -70,6 +72,17 @@ namespace MWLua
             removeFromGroup(*group, ptr);
     }
 
+    void ObjectLists::objectMoved(const MWWorld::Ptr& ptr)
+    {
+        // Called for every moving actor every frame, so it avoids `chooseGroup`. Actors are checked first.
+        const ObjectId& id = getId(ptr);
+        const osg::Vec3f position = ptr.getRefData().getPosition().asVec3();
+        for (ObjectGroup* group :
+            { &mActorsInScene, &mItemsInScene, &mActivatorsInScene, &mContainersInScene, &mDoorsInScene })
+            if (group->mIndex.move(id, position))
+                return;
+    }
+
     void ObjectLists::ObjectGroup::updateList()
     {
         if (mChanged)
@@ -86,17 +99,81 @@ namespace MWLua
         mChanged = false;
         mList->clear();
         mSet.clear();
+        mIndex.clear();
     }
 
     void ObjectLists::addToGroup(ObjectGroup& group, const MWWorld::Ptr& ptr)
     {
         group.mSet.insert(getId(ptr));
         group.mChanged = true;
+        group.mIndex.insert(getId(ptr), ptr.getRefData().getPosition().asVec3());
     }
 
     void ObjectLists::removeFromGroup(ObjectGroup& group, const MWWorld::Ptr& ptr)
     {
         group.mSet.erase(getId(ptr));
         group.mChanged = true;
+        group.mIndex.remove(getId(ptr));
+    }
+
+    template <class F>
+    void ObjectLists::forEachIndex(const Filter& filter, F&& f) const
+    {
+        const std::pair<Group, const ObjectGroup*> groups[] = {
+            { Group_Activators, &mActivatorsInScene },
+            { Group_Actors, &mActorsInScene },
+            { Group_Containers, &mContainersInScene },
+            { Group_Doors, &mDoorsInScene },
+            { Group_Items, &mItemsInScene },
+        };
+        for (const auto& [flag, group] : groups)
+            if ((filter.mGroups & flag) != 0)
+                f(group->mIndex);
+    }
+
+    ObjectIdList ObjectLists::findInSphere(const osg::Vec3f& center, float radius, const Filter& filter) const
+    {
+        ObjectIdList result = std::make_shared<std::vector<ObjectId>>();
+        forEachIndex(filter, [&](const SpatialIndex& index) { index.findInSphere(center, radius, *result); });
+        std::erase(*result, filter.mIgnore);
+        return result;
+    }
+
+    ObjectIdList ObjectLists::findInBox(const osg::Vec3f& min, const osg::Vec3f& max, const Filter& filter) const
+    {
+        ObjectIdList result = std::make_shared<std::vector<ObjectId>>();
+        forEachIndex(filter, [&](const SpatialIndex& index) { index.findInBox(min, max, *result); });
+        std::erase(*result, filter.mIgnore);
+        return result;
+    }
+
+    ObjectIdList ObjectLists::findInCone(
+        const osg::Vec3f& apex, const osg::Vec3f& direction, float angle, float distance, const Filter& filter) const
+    {
+        ObjectIdList result = std::make_shared<std::vector<ObjectId>>();
+        osg::Vec3f normalizedDirection = direction;
+        normalizedDirection.normalize();
+        forEachIndex(filter, [&](const SpatialIndex& index) {
+            index.findInCone(apex, normalizedDirection, angle, distance, *result);
+        });
+        std::erase(*result, filter.mIgnore);
+        return result;
+    }
+
+    ObjectIdList ObjectLists::findNearest(
+        const osg::Vec3f& position, std::size_t count, float maxDistance, const Filter& filter) const
+    {
+        std::vector<std::pair<float, ObjectId>> candidates;
+        forEachIndex(
+            filter, [&](const SpatialIndex& index) { index.findInDistance(position, maxDistance, candidates); });
+        std::erase_if(candidates, [&](const auto& v) { return v.second == filter.mIgnore; });
+        const auto byDistance = [](const auto& l, const auto& r) { return l.first < r.first; };
+        count = std::min(count, candidates.size());
+        std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(), byDistance);
+        ObjectIdList result = std::make_shared<std::vector<ObjectId>>();
+        result->reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            result->push_back(candidates[i].second);
+        return result;
     }
 }
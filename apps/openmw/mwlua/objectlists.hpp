@@ -2,8 +2,12 @@
 #define MWLUA_OBJECTLISTS_H
 
 #include <set>
+#include <vector>
+
+#include <osg/Vec3f>
 
 #include "object.hpp"
+#include "spatialindex.hpp"
 
 namespace MWLua
 {
@@ -12,6 +16,22 @@ namespace MWLua
     class ObjectLists
     {
     public:
+        enum Group : unsigned
+        {
+            Group_Activators = 1 << 0,
+            Group_Actors = 1 << 1,
+            Group_Containers = 1 << 2,
+            Group_Doors = 1 << 3,
+            Group_Items = 1 << 4,
+            Group_All = (1 << 5) - 1,
+        };
+
+        struct Filter
+        {
+            unsigned mGroups = Group_All;
+            ObjectId mIgnore; // not set by default
+        };
+
         void update(); // Should be called every frame.
         void clear(); // Should be called every time before starting or loading a new game.
 
@@ -24,9 +44,19 @@ namespace MWLua
 
         void objectAddedToScene(const MWWorld::Ptr& ptr);
         void objectRemovedFromScene(const MWWorld::Ptr& ptr);
+        void objectMoved(const MWWorld::Ptr& ptr);
 
         void setPlayer(const MWWorld::Ptr& player) { *mPlayers = { getId(player) }; }
 
+        // Spatial queries. Objects are returned in arbitrary order except for `findNearest` that sorts
+        // them by distance.
+        ObjectIdList findInSphere(const osg::Vec3f& center, float radius, const Filter& filter) const;
+        ObjectIdList findInBox(const osg::Vec3f& min, const osg::Vec3f& max, const Filter& filter) const;
+        ObjectIdList findInCone(const osg::Vec3f& apex, const osg::Vec3f& direction, float angle, float distance,
+            const Filter& filter) const;
+        ObjectIdList findNearest(
+            const osg::Vec3f& position, std::size_t count, float maxDistance, const Filter& filter) const;
+
     private:
         struct ObjectGroup
         {
@@ -36,8 +66,12 @@ namespace MWLua
             bool mChanged = false;
             ObjectIdList mList = std::make_shared<std::vector<ObjectId>>();
             std::set<ObjectId> mSet;
+            SpatialIndex mIndex;
         };
 
+        template <class F>
+        void forEachIndex(const Filter& filter, F&& f) const;
+
         ObjectGroup* chooseGroup(const MWWorld::Ptr& ptr);
         void addToGroup(ObjectGroup& group, const MWWorld::Ptr& ptr);
         void removeFromGroup(ObjectGroup& group, const MWWorld::Ptr& ptr);
@@ -0,0 +1,152 @@
+#include "spatialindex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace MWLua
+{
+    namespace
+    {
+        constexpr float maxCoordinate = SpatialIndex::sCellSize * (1 << 20);
+
+        int getCellIndex(float coordinate)
+        {
+            // Positions are expected to be finite, but NaN must not get into the cast below.
+            if (std::isnan(coordinate))
+                return 0;
+            const float clamped = std::clamp(coordinate, -maxCoordinate, maxCoordinate);
+            return static_cast<int>(std::floor(clamped / SpatialIndex::sCellSize));
+        }
+    }
+
+    SpatialIndex::Cell SpatialIndex::getCell(const osg::Vec3f& position)
+    {
+        return { getCellIndex(position.x()), getCellIndex(position.y()) };
+    }
+
+    void SpatialIndex::insert(const ESM::RefNum& id, const osg::Vec3f& position)
+    {
+        if (move(id, position))
+            return;
+        const Cell cell = getCell(position);
+        mCells[cell].push_back(Entry{ position, id });
+        mObjectCells.emplace(id, cell);
+    }
+
+    void SpatialIndex::remove(const ESM::RefNum& id)
+    {
+        const auto it = mObjectCells.find(id);
+        if (it == mObjectCells.end())
+            return;
+        const auto cell = mCells.find(it->second);
+        std::vector<Entry>& entries = cell->second;
+        const auto entry = std::find_if(entries.begin(), entries.end(), [&](const Entry& v) { return v.mId == id; });
+        *entry = entries.back();
+        entries.pop_back();
+        if (entries.empty())
+            mCells.erase(cell);
+        mObjectCells.erase(it);
+    }
+
+    bool SpatialIndex::move(const ESM::RefNum& id, const osg::Vec3f& position)
+    {
+        const auto it = mObjectCells.find(id);
+        if (it == mObjectCells.end())
+            return false;
+        const Cell cell = getCell(position);
+        if (cell == it->second)
+        {
+            std::vector<Entry>& entries = mCells.find(cell)->second;
+            std::find_if(entries.begin(), entries.end(), [&](const Entry& v) { return v.mId == id; })->mPosition
+                = position;
+            return true;
+        }
+        remove(id);
+        mCells[cell].push_back(Entry{ position, id });
+        mObjectCells.emplace(id, cell);
+        return true;
+    }
+
+    void SpatialIndex::clear()
+    {
+        mCells.clear();
+        mObjectCells.clear();
+    }
+
+    template <class F>
+    void SpatialIndex::forEachInBox(const osg::Vec3f& min, const osg::Vec3f& max, F&& f) const
+    {
+        const auto visit = [&](const std::vector<Entry>& entries) {
+            for (const Entry& entry : entries)
+            {
+                const osg::Vec3f& pos = entry.mPosition;
+                if (pos.x() >= min.x() && pos.y() >= min.y() && pos.z() >= min.z() && pos.x() <= max.x()
+                    && pos.y() <= max.y() && pos.z() <= max.z())
+                    f(entry);
+            }
+        };
+        const Cell minCell = getCell(min);
+        const Cell maxCell = getCell(max);
+        if (minCell.first > maxCell.first || minCell.second > maxCell.second)
+            return;
+        const std::int64_t cellsInBox = (static_cast<std::int64_t>(maxCell.first) - minCell.first + 1)
+            * (static_cast<std::int64_t>(maxCell.second) - minCell.second + 1);
+        // Big areas are faster to check going through the occupied cells only.
+        if (cellsInBox > static_cast<std::int64_t>(mCells.size()))
+        {
+            for (const auto& [cell, entries] : mCells)
+                if (cell.first >= minCell.first && cell.first <= maxCell.first && cell.second >= minCell.second
+                    && cell.second <= maxCell.second)
+                    visit(entries);
+            return;
+        }
+        for (int x = minCell.first; x <= maxCell.first; ++x)
+        {
+            auto it = mCells.lower_bound(Cell(x, minCell.second));
+            for (; it != mCells.end() && it->first.first == x && it->first.second <= maxCell.second; ++it)
+                visit(it->second);
+        }
+    }
+
+    void SpatialIndex::findInSphere(const osg::Vec3f& center, float radius, std::vector<ESM::RefNum>& result) const
+    {
+        const osg::Vec3f extents(radius, radius, radius);
+        const float radius2 = radius * radius;
+        forEachInBox(center - extents, center + extents, [&](const Entry& entry) {
+            if ((entry.mPosition - center).length2() <= radius2)
+                result.push_back(entry.mId);
+        });
+    }
+
+    void SpatialIndex::findInBox(const osg::Vec3f& min, const osg::Vec3f& max, std::vector<ESM::RefNum>& result) const
+    {
+        forEachInBox(min, max, [&](const Entry& entry) { result.push_back(entry.mId); });
+    }
+
+    void SpatialIndex::findInCone(const osg::Vec3f& apex, const osg::Vec3f& direction, float angle, float distance,
+        std::vector<ESM::RefNum>& result) const
+    {
+        const float cosAngle = std::cos(angle);
+        const osg::Vec3f extents(distance, distance, distance);
+        const float distance2 = distance * distance;
+        forEachInBox(apex - extents, apex + extents, [&](const Entry& entry) {
+            const osg::Vec3f diff = entry.mPosition - apex;
+            const float diffLength2 = diff.length2();
+            if (diffLength2 <= distance2 && diff * direction >= cosAngle * std::sqrt(diffLength2))
+                result.push_back(entry.mId);
+        });
+    }
+
+    void SpatialIndex::findInDistance(
+        const osg::Vec3f& position, float maxDistance, std::vector<std::pair<float, ESM::RefNum>>& result) const
+    {
+        const osg::Vec3f extents(maxDistance, maxDistance, maxDistance);
+        const float maxDistance2 = maxDistance * maxDistance;
+        forEachInBox(position - extents, position + extents, [&](const Entry& entry) {
+            const float distance2 = (entry.mPosition - position).length2();
+            if (distance2 <= maxDistance2)
+                result.emplace_back(distance2, entry.mId);
+        });
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef MWLUA_SPATIALINDEX_H
+#define MWLUA_SPATIALINDEX_H
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <osg/Vec3f>
+
+#include <components/esm3/cellref.hpp>
+
+namespace MWLua
+{
+
+    // Positions of objects grouped by cells of a uniform 2D grid. It is updated incrementally when objects are
+    // added, removed or moved, so queries don't need to touch the game world.
+    class SpatialIndex
+    {
+    public:
+        static constexpr float sCellSize = 1024;
+
+        void insert(const ESM::RefNum& id, const osg::Vec3f& position);
+        void remove(const ESM::RefNum& id);
+        // Returns false if the object is not in the index.
+        bool move(const ESM::RefNum& id, const osg::Vec3f& position);
+        void clear();
+
+        std::size_t size() const { return mObjectCells.size(); }
+
+        // All functions below append objects to `result` in arbitrary order.
+        void findInSphere(const osg::Vec3f& center, float radius, std::vector<ESM::RefNum>& result) const;
+        void findInBox(const osg::Vec3f& min, const osg::Vec3f& max, std::vector<ESM::RefNum>& result) const;
+        // `direction` should be normalized, `angle` is between the axis and the side of the cone.
+        void findInCone(const osg::Vec3f& apex, const osg::Vec3f& direction, float angle, float distance,
+            std::vector<ESM::RefNum>& result) const;
+        // Appends pairs of squared distance and object.
+        void findInDistance(const osg::Vec3f& position, float maxDistance,
+            std::vector<std::pair<float, ESM::RefNum>>& result) const;
+
+    private:
+        using Cell = std::pair<int, int>;
+
+        struct Entry
+        {
+            osg::Vec3f mPosition;
+            ESM::RefNum mId;
+        };
+
+        static Cell getCell(const osg::Vec3f& position);
+
+        template <class F>
+        void forEachInBox(const osg::Vec3f& min, const osg::Vec3f& max, F&& f) const;
+
+        std::map<Cell, std::vector<Entry>> mCells;
+        std::map<ESM::RefNum, Cell> mObjectCells;
+    };
+
+}
+
+#endif // MWLUA_SPATIALINDEX_H
@@ -4,6 +4,7 @@
 
 #include <components/detournavigator/agentbounds.hpp>
 #include <components/lua/luastate.hpp>
+#include <components/lua/utilpackage.hpp>
 
 #include "apps/openmw/mwbase/mechanicsmanager.hpp"
 #include "apps/openmw/mwbase/windowmanager.hpp"
@@ -16,10 +17,118 @@
 #include "../localscripts.hpp"
 #include "../luamanagerimp.hpp"
 #include "../magicbindings.hpp"
+#include "../objectbindings.hpp"
 #include "../stats.hpp"
 
 namespace MWLua
 {
+    namespace
+    {
+        enum class BulkField
+        {
+            Position,
+            Rotation,
+            RecordId,
+            Health,
+            Magicka,
+            Fatigue,
+            CurrentSpeed,
+            IsDead,
+        };
+
+        BulkField getBulkField(std::string_view name)
+        {
+            static const std::map<std::string_view, BulkField, std::less<>> fields{
+                { "position", BulkField::Position },
+                { "rotation", BulkField::Rotation },
+                { "recordId", BulkField::RecordId },
+                { "health", BulkField::Health },
+                { "magicka", BulkField::Magicka },
+                { "fatigue", BulkField::Fatigue },
+                { "currentSpeed", BulkField::CurrentSpeed },
+                { "isDead", BulkField::IsDead },
+            };
+            auto it = fields.find(name);
+            if (it == fields.end())
+                throw std::runtime_error("Unknown field: " + std::string(name));
+            return it->second;
+        }
+
+        // Accepts ObjectList or a table of objects.
+        std::vector<MWWorld::Ptr> getPtrs(const sol::object& objects)
+        {
+            std::vector<MWWorld::Ptr> result;
+            const auto addIds = [&](const ObjectIdList& ids) {
+                const MWWorld::WorldModel& worldModel = *MWBase::Environment::get().getWorldModel();
+                result.reserve(ids->size());
+                for (const ObjectId& id : *ids)
+                    result.push_back(worldModel.getPtr(id));
+            };
+            if (objects.is<LObjectList>())
+                addIds(objects.as<LObjectList>().mIds);
+            else if (objects.is<GObjectList>())
+                addIds(objects.as<GObjectList>().mIds);
+            else
+            {
+                const sol::table table = LuaUtil::cast<sol::table>(objects);
+                const std::size_t size = table.size();
+                result.reserve(size);
+                for (std::size_t i = 1; i <= size; ++i)
+                    result.push_back(LuaUtil::cast<Object>(table.get<sol::object>(i)).ptrOrEmpty());
+            }
+            return result;
+        }
+
+        sol::object getBulkValue(lua_State* lua, const MWWorld::Ptr& ptr, BulkField field)
+        {
+            switch (field)
+            {
+                case BulkField::Position:
+                    return sol::make_object(lua, ptr.getRefData().getPosition().asVec3());
+                case BulkField::Rotation:
+                    return sol::make_object(lua, LuaUtil::TransformQ{ toQuat(ptr.getRefData().getPosition(), true) });
+                case BulkField::RecordId:
+                    return sol::make_object(lua, ptr.getCellRef().getRefId().serializeText());
+                case BulkField::Health:
+                    return sol::make_object(lua, ptr.getClass().getCreatureStats(ptr).getHealth().getCurrent());
+                case BulkField::Magicka:
+                    return sol::make_object(lua, ptr.getClass().getCreatureStats(ptr).getMagicka().getCurrent());
+                case BulkField::Fatigue:
+                    return sol::make_object(lua, ptr.getClass().getCreatureStats(ptr).getFatigue().getCurrent());
+                case BulkField::CurrentSpeed:
+                    return sol::make_object(lua, ptr.getClass().getCurrentSpeed(ptr));
+                case BulkField::IsDead:
+                    return sol::make_object(lua, ptr.getClass().getCreatureStats(ptr).isDead());
+            }
+            throw std::logic_error("Unexpected bulk field");
+        }
+
+        // Returns a table with an array per requested field; arrays have the same order as `objects`.
+        // Values of objects that are not available or not actors are nil.
+        sol::table getBulk(sol::this_state lua, const sol::object& objects, const sol::table& fieldNames)
+        {
+            std::vector<std::pair<BulkField, sol::table>> columns;
+            sol::table result(lua, sol::create);
+            const std::vector<MWWorld::Ptr> ptrs = getPtrs(objects);
+            for (const auto& [_, name] : fieldNames)
+            {
+                const std::string_view fieldName = LuaUtil::cast<std::string_view>(name);
+                sol::table column(lua, sol::new_table(static_cast<int>(ptrs.size()), 0));
+                result[fieldName] = column;
+                columns.emplace_back(getBulkField(fieldName), std::move(column));
+            }
+            for (std::size_t i = 0; i < ptrs.size(); ++i)
+            {
+                const MWWorld::Ptr& ptr = ptrs[i];
+                if (ptr.isEmpty() || !ptr.getClass().isActor())
+                    continue;
+                for (auto& [field, column] : columns)
+                    column.raw_set(i + 1, getBulkValue(lua, ptr, field));
+            }
+            return result;
+        }
+    }
+
     using EquipmentItem = std::variant<std::string, ObjectId>;
     using Equipment = std::map<int, EquipmentItem>;
     static constexpr int sAnySlot = -1;
@@ -359,6 +468,8 @@ namespace MWLua
             return result;
         };
 
+        actor["getBulk"] = &getBulk;
+
         addActorStatsBindings(actor, context);
         addActorMagicBindings(actor, context);
     }
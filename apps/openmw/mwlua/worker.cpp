@@ -16,7 +16,10 @@ namespace MWLua
         , mViewer(viewer)
     {
         if (Settings::lua().mLuaNumThreads > 0)
+        {
+            mPipelined = Settings::lua().mLuaPipelinedUpdate;
             mThread = std::thread([this] { run(); });
+        }
     }
 
     Worker::~Worker()
@@ -42,13 +45,18 @@ namespace MWLua
 
     void Worker::finishUpdate()
     {
-        if (mThread)
-        {
-            std::unique_lock<std::mutex> lk(mMutex);
-            mCV.wait(lk, [&] { return !mUpdateRequest; });
-        }
-        else
+        if (!mThread)
             update();
+        else if (!mPipelined)
+            waitForUpdate();
+    }
+
+    void Worker::waitForUpdate()
+    {
+        if (!mThread)
+            return;
+        std::unique_lock<std::mutex> lk(mMutex);
+        mCV.wait(lk, [&] { return !mUpdateRequest; });
     }
 
     void Worker::join()
@@ -24,8 +24,12 @@ namespace MWLua
 
         void allowUpdate();
 
+        // Called after rendering. Waits for the update unless the pipelined update is enabled.
         void finishUpdate();
 
+        // Waits for the update started by allowUpdate. Should be called before the main thread changes the game world.
+        void waitForUpdate();
+
         void join();
 
     private:
@@ -39,6 +43,7 @@ namespace MWLua
         std::condition_variable mCV;
         bool mUpdateRequest = false;
         bool mJoinRequest = false;
+        bool mPipelined = false;
         std::optional<std::thread> mThread;
     };
 }
@@ -215,8 +215,8 @@ namespace MWMechanics
                 ++spellIt;
         }
 
-        for (const auto& spell : mQueue)
-            addToSpells(ptr, spell);
+        for (auto& spell : mQueue)
+            addToSpells(ptr, std::move(spell));
         mQueue.clear();
 
         // Vanilla only does this on cell change I think
@@ -271,11 +271,25 @@ namespace MWMechanics
         const MWWorld::Ptr player = MWMechanics::getPlayer();
         bool updatedHitOverlay = false;
         bool updatedEnemy = false;
+        // Searching a caster goes through all actors of active cells, most of the spells are cast by the actor itself
+        // (abilities, diseases, constant effect enchantments) or by a few casters so do it once per caster.
+        std::vector<std::pair<int, MWWorld::Ptr>> casters;
+        const auto findCaster = [&](int casterActorId) -> MWWorld::Ptr {
+            if (creatureStats.matchesActorId(casterActorId) && ptr.getRefData().getCount() > 0)
+                return ptr;
+            const auto it = std::find_if(casters.begin(), casters.end(),
+                [&](const auto& v) { return v.first == casterActorId; });
+            if (it != casters.end())
+                return it->second;
+            // Maybe make this search outside active grid?
+            MWWorld::Ptr caster = MWBase::Environment::get().getWorld()->searchPtrViaActorId(casterActorId);
+            casters.emplace_back(casterActorId, caster);
+            return caster;
+        };
         // Update effects
         for (auto spellIt = mSpells.begin(); spellIt != mSpells.end();)
         {
-            const auto caster = MWBase::Environment::get().getWorld()->searchPtrViaActorId(
-                spellIt->mCasterActorId); // Maybe make this search outside active grid?
+            const auto caster = findCaster(spellIt->mCasterActorId);
             bool removedSpell = false;
             std::optional<ActiveSpellParams> reflected;
             for (auto it = spellIt->mEffects.begin(); it != spellIt->mEffects.end();)
@@ -363,7 +377,7 @@ namespace MWMechanics
             }
             if (remove)
             {
-                auto params = *spellIt;
+                auto params = std::move(*spellIt);
                 spellIt = mSpells.erase(spellIt);
                 for (const auto& effect : params.mEffects)
                     onMagicEffectRemoved(ptr, params, effect);
@@ -382,7 +396,7 @@ namespace MWMechanics
         }
     }
 
-    void ActiveSpells::addToSpells(const MWWorld::Ptr& ptr, const ActiveSpellParams& spell)
+    void ActiveSpells::addToSpells(const MWWorld::Ptr& ptr, ActiveSpellParams&& spell)
     {
         if (spell.mType != ESM::ActiveSpells::Type_Consumable)
         {
@@ -394,13 +408,13 @@ namespace MWMechanics
             {
                 if (merge(found->mEffects, spell.mEffects))
                     return;
-                auto params = *found;
+                auto params = std::move(*found);
                 mSpells.erase(found);
                 for (const auto& effect : params.mEffects)
                     onMagicEffectRemoved(ptr, params, effect);
             }
         }
-        mSpells.emplace_back(spell);
+        mSpells.push_back(std::move(spell));
     }
 
     ActiveSpells::ActiveSpells()
@@ -498,7 +512,7 @@ namespace MWMechanics
                         {
                             if (variant(*spellIt))
                             {
-                                auto params = *spellIt;
+                                auto params = std::move(*spellIt);
                                 spellIt = mSpells.erase(spellIt);
                                 if (isCurrentSpell)
                                 {
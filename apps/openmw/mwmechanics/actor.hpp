@@ -1,11 +1,14 @@
 #ifndef OPENMW_MECHANICS_ACTOR_H
 #define OPENMW_MECHANICS_ACTOR_H
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 
 #include "character.hpp"
 #include "creaturestats.hpp"
 #include "greetingstate.hpp"
+#include "movement.hpp"
 
 #include "../mwbase/environment.hpp"
 #include "../mwbase/world.hpp"
@@ -62,6 +65,24 @@ namespace MWMechanics
         void setPositionAdjusted(bool adjusted) { mPositionAdjusted = adjusted; }
         bool getPositionAdjusted() const { return mPositionAdjusted; }
 
+        /// Accumulates time since the last AI update, returns the total
+        float addAiDuration(float duration) { return mAiDuration += duration; }
+        void resetAiDuration() { mAiDuration = 0; }
+
+        /// Remembers movement requested by the last AI update to keep it on frames without AI update
+        void storeAiMovement(const Movement& movement)
+        {
+            std::copy(std::begin(movement.mPosition), std::end(movement.mPosition) - 1, std::begin(mAiPosition));
+            std::copy(std::begin(movement.mRotation), std::end(movement.mRotation), std::begin(mAiRotation));
+        }
+
+        /// Requests the same movement and rotation delta as the last AI update did. Jump is not repeated.
+        void restoreAiMovement(Movement& movement) const
+        {
+            std::copy(std::begin(mAiPosition), std::end(mAiPosition), std::begin(movement.mPosition));
+            std::copy(std::begin(mAiRotation), std::end(mAiRotation), std::begin(movement.mRotation));
+        }
+
     private:
         CharacterController mCharacterController;
         int mGreetingTimer{ 0 };
@@ -71,6 +92,9 @@ namespace MWMechanics
         Misc::DeviatingPeriodicTimer mEngageCombat{ 1.0f, 0.25f,
             Misc::Rng::deviate(0, 0.25f, MWBase::Environment::get().getWorld()->getPrng()) };
         bool mPositionAdjusted;
+        float mAiDuration = 0;
+        float mAiPosition[2] = { 0, 0 };
+        float mAiRotation[3] = { 0, 0, 0 };
     };
 
 }
@@ -1,5 +1,6 @@
 #include "actors.hpp"
 
+#include <algorithm>
 #include <array>
 #include <optional>
 
@@ -54,6 +55,9 @@
 
 namespace
 {
+    // Actors grid is faster than checking all actors only for small radiuses like the head tracking distance. For
+    // bigger ones like the actors processing range it's slower (measured by apps/benchmarks/misc/uniformgrid.cpp).
+    constexpr float maxActorsGridQueryRadius = 2048;
 
     bool isConscious(const MWWorld::Ptr& ptr)
     {
@@ -98,6 +102,27 @@ namespace
         });
     }
 
+    // Number of frames between AI updates of the actor, distant actors are updated less often unless they interact
+    // with the player
+    int getAiUpdateInterval(const MWWorld::Ptr& actor, const MWWorld::Ptr& player, float distSqr)
+    {
+        const float lodDistance = Settings::game().mAiLodDistance;
+        if (lodDistance <= 0 || distSqr < lodDistance * lodDistance)
+            return 1;
+
+        MWMechanics::CreatureStats& stats = actor.getClass().getCreatureStats(actor);
+        const MWMechanics::AiSequence& sequence = stats.getAiSequence();
+        if (sequence.isInCombat() || sequence.isInPursuit())
+            return 1;
+        if (!sequence.isEmpty() && sequence.getActivePackage().getTarget() == player)
+            return 1;
+        if (player.getClass().getCreatureStats(player).getHitAttemptActorId() == stats.getActorId())
+            return 1;
+
+        const int band = static_cast<int>(std::sqrt(distSqr) / lodDistance);
+        return std::min(band + 1, Settings::game().mAiLodMaxInterval.get());
+    }
+
     std::pair<float, float> getRestorationPerHourOfSleep(const MWWorld::Ptr& ptr)
     {
         const MWMechanics::CreatureStats& stats = ptr.getClass().getCreatureStats(ptr);
@@ -298,8 +323,17 @@ namespace MWMechanics
             }
         }
 
-        void updateHeadTracking(
-            const MWWorld::Ptr& ptr, const std::list<Actor>& actors, bool isPlayer, CharacterController& ctrl)
+        float getMaxHeadTrackDistance()
+        {
+            const MWWorld::Store<ESM::GameSetting>& gmst
+                = MWBase::Environment::get().getESMStore()->get<ESM::GameSetting>();
+            static const float fMaxHeadTrackDistance = gmst.find("fMaxHeadTrackDistance")->mValue.getFloat();
+            static const float fInteriorHeadTrackMult = gmst.find("fInteriorHeadTrackMult")->mValue.getFloat();
+            return fMaxHeadTrackDistance * std::max(1.0f, fInteriorHeadTrackMult);
+        }
+
+        void updateHeadTracking(const MWWorld::Ptr& ptr, const std::vector<const Actor*>& nearbyActors, bool isPlayer,
+            CharacterController& ctrl)
         {
             float sqrHeadTrackDistance = std::numeric_limits<float>::max();
             MWWorld::Ptr headTrackTarget;
@@ -326,13 +360,13 @@ namespace MWMechanics
                 else
                 {
                     // Find something nearby.
-                    for (const Actor& otherActor : actors)
+                    for (const Actor* otherActor : nearbyActors)
                     {
-                        if (otherActor.getPtr() == ptr)
+                        if (otherActor->getPtr() == ptr)
                             continue;
 
                         updateHeadTracking(
-                            ptr, otherActor.getPtr(), headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
+                            ptr, otherActor->getPtr(), headTrackTarget, sqrHeadTrackDistance, inCombatOrPursue);
                     }
                 }
             }
@@ -1170,6 +1204,7 @@ namespace MWMechanics
             return;
         const auto it = mActors.emplace(mActors.end(), ptr, anim);
         mIndex.emplace(ptr.mRef, it);
+        mActorsGrid.clear();
 
         if (updateImmediately)
             it->getCharacterController().update(0);
@@ -1222,6 +1257,7 @@ namespace MWMechanics
                 removeTemporaryEffects(iter->second->getPtr());
             mActors.erase(iter->second);
             mIndex.erase(iter);
+            mActorsGrid.clear();
         }
     }
 
@@ -1279,6 +1315,7 @@ namespace MWMechanics
                 removeTemporaryEffects(iter->getPtr());
                 mIndex.erase(iter->getPtr().mRef);
                 iter = mActors.erase(iter);
+                mActorsGrid.clear();
             }
             else
                 ++iter;
@@ -1330,7 +1367,7 @@ namespace MWMechanics
         }
     }
 
-    void Actors::predictAndAvoidCollisions(float duration) const
+    void Actors::predictAndAvoidCollisions(float duration)
     {
         if (!MWBase::Environment::get().getMechanicsManager()->isAIActive())
             return;
@@ -1343,29 +1380,41 @@ namespace MWMechanics
 
         const MWWorld::Ptr player = getPlayer();
         const MWBase::World* const world = MWBase::Environment::get().getWorld();
+
+        // Gather everything prediction needs from the world, the following phase runs in parallel and reads only
+        // this state.
         for (const Actor& actor : mActors)
         {
             const MWWorld::Ptr& ptr = actor.getPtr();
+            const ESM::Position& position = ptr.getRefData().getPosition();
+            Movement& movement = ptr.getClass().getMovementSettings(ptr);
+            CollisionAvoidance& state = mCollisionAvoidance.emplace_back();
+            state.mPtr = ptr;
+            state.mPosition = position.asVec3();
+            state.mRotZ = position.rot[2];
+            state.mHalfExtents = world->getHalfExtents(ptr);
+            state.mMaxSpeed = ptr.getClass().getMaxSpeed(ptr);
+            state.mMovement = movement.asVec3();
+            state.mIsDead = ptr.getClass().getCreatureStats(ptr).isDead();
+            mCollisionAvoidanceGrid.add(state.mPosition, mCollisionAvoidance.size() - 1);
+
             if (ptr == player)
                 continue; // Don't interfere with player controls.
 
-            const float maxSpeed = ptr.getClass().getMaxSpeed(ptr);
-            if (maxSpeed == 0.0)
+            if (state.mMaxSpeed == 0.0)
                 continue; // Can't move, so there is no sense to predict collisions.
 
-            Movement& movement = ptr.getClass().getMovementSettings(ptr);
             const osg::Vec2f origMovement(movement.mPosition[0], movement.mPosition[1]);
-            const bool isMoving = origMovement.length2() > 0.01;
+            state.mIsMoving = origMovement.length2() > 0.01;
             if (movement.mPosition[1] < 0)
                 continue; // Actors can not see others when move backward.
 
             // Moving NPCs always should avoid collisions.
             // Standing NPCs give way to moving ones if they are not in combat (or pursue) mode and either
             // follow player or have a AIWander package with non-empty wander area.
-            bool shouldAvoidCollision = isMoving;
+            bool shouldAvoidCollision = state.mIsMoving;
             bool shouldGiveWay = false;
-            bool shouldTurnToApproachingActor = !isMoving;
-            MWWorld::Ptr currentTarget; // Combat or pursue target (NPCs should not avoid collision with their targets).
+            state.mShouldTurnToApproachingActor = !state.mIsMoving;
             const auto& aiSequence = ptr.getClass().getCreatureStats(ptr).getAiSequence();
             if (!aiSequence.isEmpty())
             {
@@ -1382,40 +1431,45 @@ namespace MWMechanics
                 else if (package.getTypeId() == AiPackageTypeId::Combat
                     || package.getTypeId() == AiPackageTypeId::Pursue)
                 {
-                    currentTarget = package.getTarget();
-                    shouldAvoidCollision = isMoving;
-                    shouldTurnToApproachingActor = false;
+                    state.mCurrentTarget = package.getTarget();
+                    shouldAvoidCollision = state.mIsMoving;
+                    state.mShouldTurnToApproachingActor = false;
                 }
             }
 
             if (!shouldAvoidCollision && !shouldGiveWay)
                 continue;
 
-            const osg::Vec2f baseSpeed = origMovement * maxSpeed;
-            const osg::Vec3f basePos = ptr.getRefData().getPosition().asVec3();
-            const float baseRotZ = ptr.getRefData().getPosition().rot[2];
-            const osg::Vec3f halfExtents = world->getHalfExtents(ptr);
-            const float maxDistToCheck = isMoving ? maxDistForPartialAvoiding : maxDistForStrictAvoiding;
-
-            float timeToCheck = maxTimeToCheck;
+            state.mShouldAvoid = true;
+            state.mTimeToCheck = maxTimeToCheck;
             if (!shouldGiveWay && !aiSequence.isEmpty())
-                timeToCheck = std::min(
-                    timeToCheck, getTimeToDestination(**aiSequence.begin(), basePos, maxSpeed, duration, halfExtents));
+                state.mTimeToCheck = std::min(state.mTimeToCheck,
+                    getTimeToDestination(
+                        **aiSequence.begin(), state.mPosition, state.mMaxSpeed, duration, state.mHalfExtents));
+        }
+        mCollisionAvoidanceGrid.build();
+
+        // Finds possible collisions of an actor in the order of other actors. Reads only the gathered state so it can
+        // run for different actors in parallel.
+        const auto predictCollisions = [&](std::size_t index) {
+            CollisionAvoidance& state = mCollisionAvoidance[index];
+            state.mCollisions.clear();
+            state.mNearby.clear();
+            if (!state.mShouldAvoid)
+                return;
 
-            float timeToCollision = timeToCheck;
-            osg::Vec2f movementCorrection(0, 0);
-            float angleToApproachingActor = 0;
+            const osg::Vec2f baseSpeed = osg::Vec2f(state.mMovement.x(), state.mMovement.y()) * state.mMaxSpeed;
+            const float maxDistToCheck = state.mIsMoving ? maxDistForPartialAvoiding : maxDistForStrictAvoiding;
 
-            // Iterate through all other actors and predict collisions.
-            for (const Actor& otherActor : mActors)
+            mCollisionAvoidanceGrid.findInRange(state.mPosition, maxDistToCheck, state.mNearby);
+            for (const std::size_t otherIndex : state.mNearby)
             {
-                const MWWorld::Ptr& otherPtr = otherActor.getPtr();
-                if (otherPtr == ptr || otherPtr == currentTarget)
+                const CollisionAvoidance& other = mCollisionAvoidance[otherIndex];
+                if (otherIndex == index || other.mPtr == state.mCurrentTarget)
                     continue;
 
-                const osg::Vec3f otherHalfExtents = world->getHalfExtents(otherPtr);
-                const osg::Vec3f deltaPos = otherPtr.getRefData().getPosition().asVec3() - basePos;
-                const osg::Vec2f relPos = Misc::rotateVec2f(osg::Vec2f(deltaPos.x(), deltaPos.y()), baseRotZ);
+                const osg::Vec3f deltaPos = other.mPosition - state.mPosition;
+                const osg::Vec2f relPos = Misc::rotateVec2f(osg::Vec2f(deltaPos.x(), deltaPos.y()), state.mRotZ);
                 const float dist = deltaPos.length();
 
                 // Ignore actors which are not close enough or come from behind.
@@ -1423,16 +1477,14 @@ namespace MWMechanics
                     continue;
 
                 // Don't check for a collision if vertical distance is greater then the actor's height.
-                if (deltaPos.z() > halfExtents.z() * 2 || deltaPos.z() < -otherHalfExtents.z() * 2)
+                if (deltaPos.z() > state.mHalfExtents.z() * 2 || deltaPos.z() < -other.mHalfExtents.z() * 2)
                     continue;
 
-                const osg::Vec3f speed = otherPtr.getClass().getMovementSettings(otherPtr).asVec3()
-                    * otherPtr.getClass().getMaxSpeed(otherPtr);
-                const float rotZ = otherPtr.getRefData().getPosition().rot[2];
+                const osg::Vec3f speed = other.mMovement * other.mMaxSpeed;
                 const osg::Vec2f relSpeed
-                    = Misc::rotateVec2f(osg::Vec2f(speed.x(), speed.y()), baseRotZ - rotZ) - baseSpeed;
+                    = Misc::rotateVec2f(osg::Vec2f(speed.x(), speed.y()), state.mRotZ - other.mRotZ) - baseSpeed;
 
-                float collisionDist = minGap + halfExtents.x() + otherHalfExtents.x();
+                float collisionDist = minGap + state.mHalfExtents.x() + other.mHalfExtents.x();
                 collisionDist = std::min(collisionDist, relPos.length());
 
                 // Find the earliest `t` when |relPos + relSpeed * t| == collisionDist.
@@ -1443,45 +1495,90 @@ namespace MWMechanics
                     continue; // No solution; distance is always >= collisionDist.
                 const float t = (-vr - std::sqrt(Dh)) / v2;
 
-                if (t < 0 || t > timeToCollision)
-                    continue;
-
-                // Check visibility and awareness last as it's expensive.
-                if (!MWBase::Environment::get().getWorld()->getLOS(otherPtr, ptr))
-                    continue;
-                if (!MWBase::Environment::get().getMechanicsManager()->awarenessCheck(otherPtr, ptr))
+                if (t < 0 || t > state.mTimeToCheck)
                     continue;
 
-                timeToCollision = t;
-                angleToApproachingActor = std::atan2(deltaPos.x(), deltaPos.y());
                 const osg::Vec2f posAtT = relPos + relSpeed * t;
                 const float coef = (posAtT.x() * relSpeed.x() + posAtT.y() * relSpeed.y())
-                    / (collisionDist * collisionDist * maxSpeed)
+                    / (collisionDist * collisionDist * state.mMaxSpeed)
                     * std::clamp(
                         (maxDistForPartialAvoiding - dist) / (maxDistForPartialAvoiding - maxDistForStrictAvoiding),
                         0.f, 1.f);
-                movementCorrection = posAtT * coef;
-                if (otherPtr.getClass().getCreatureStats(otherPtr).isDead())
+                osg::Vec2f movementCorrection = posAtT * coef;
+                if (other.mIsDead)
                     // In case of dead body still try to go around (it looks natural), but reduce the correction twice.
                     movementCorrection.y() *= 0.5f;
+
+                state.mCollisions.push_back(PredictedCollision{
+                    .mOther = otherIndex,
+                    .mTime = t,
+                    .mAngle = std::atan2(deltaPos.x(), deltaPos.y()),
+                    .mMovementCorrection = movementCorrection,
+                });
             }
+        };
+
+        if (mJobPool == nullptr)
+            mJobPool = std::make_unique<Misc::JobPool>(Settings::game().mNPCsAvoidCollisionsThreads);
+
+        mJobPool->parallelFor(mCollisionAvoidance.size(), predictCollisions);
 
-            if (timeToCollision < timeToCheck)
+        // Apply in actors order as if each actor was processed after correction of the previous ones. Visibility and
+        // awareness are checked in the same order to keep the sequence of random rolls.
+        for (std::size_t index = 0; index < mCollisionAvoidance.size(); ++index)
+        {
+            CollisionAvoidance& state = mCollisionAvoidance[index];
+            if (!state.mShouldAvoid)
+                continue;
+
+            // Predictions have used movement of the nearby actors before correction
+            if (std::any_of(state.mNearby.begin(), state.mNearby.end(),
+                    [&](std::size_t other) { return mCollisionAvoidance[other].mCorrected; }))
+                predictCollisions(index);
+
+            float timeToCollision = state.mTimeToCheck;
+            const PredictedCollision* nearestCollision = nullptr;
+            for (const PredictedCollision& collision : state.mCollisions)
             {
-                // Try to evade the nearest collision.
-                osg::Vec2f newMovement = origMovement + movementCorrection;
-                // Step to the side rather than backward. Otherwise player will be able to push the NPC far away from
-                // it's original location.
-                newMovement.y() = std::max(newMovement.y(), 0.f);
-                newMovement.normalize();
-                if (isMoving)
-                    newMovement *= origMovement.length(); // Keep the original speed.
-                movement.mPosition[0] = newMovement.x();
-                movement.mPosition[1] = newMovement.y();
-                if (shouldTurnToApproachingActor)
-                    zTurn(ptr, angleToApproachingActor);
+                if (collision.mTime > timeToCollision)
+                    continue;
+
+                const MWWorld::Ptr& otherPtr = mCollisionAvoidance[collision.mOther].mPtr;
+
+                // Check visibility and awareness last as it's expensive.
+                if (!MWBase::Environment::get().getWorld()->getLOS(otherPtr, state.mPtr))
+                    continue;
+                if (!MWBase::Environment::get().getMechanicsManager()->awarenessCheck(otherPtr, state.mPtr))
+                    continue;
+
+                timeToCollision = collision.mTime;
+                nearestCollision = &collision;
             }
+
+            if (nearestCollision == nullptr || timeToCollision >= state.mTimeToCheck)
+                continue;
+
+            // Try to evade the nearest collision.
+            Movement& movement = state.mPtr.getClass().getMovementSettings(state.mPtr);
+            const osg::Vec2f origMovement(state.mMovement.x(), state.mMovement.y());
+            osg::Vec2f newMovement = origMovement + nearestCollision->mMovementCorrection;
+            // Step to the side rather than backward. Otherwise player will be able to push the NPC far away from
+            // it's original location.
+            newMovement.y() = std::max(newMovement.y(), 0.f);
+            newMovement.normalize();
+            if (state.mIsMoving)
+                newMovement *= origMovement.length(); // Keep the original speed.
+            movement.mPosition[0] = newMovement.x();
+            movement.mPosition[1] = newMovement.y();
+            if (state.mShouldTurnToApproachingActor)
+                zTurn(state.mPtr, nearestCollision->mAngle);
+            state.mMovement = movement.asVec3();
+            state.mCorrected = true;
         }
+
+        // Don't keep references to actors which may be removed before the next update
+        mCollisionAvoidance.clear();
+        mCollisionAvoidanceGrid.clear();
     }
 
     void Actors::update(float duration, bool paused)
@@ -1526,6 +1623,9 @@ namespace MWMechanics
             const bool godmode = MWBase::Environment::get().getWorld()->getGodModeState();
             const int actorsProcessingRange = Settings::game().mActorsProcessingRange;
 
+            buildActorsGrid();
+            std::vector<const Actor*> nearbyActors;
+
             // AI and magic effects update
             for (Actor& actor : mActors)
             {
@@ -1578,6 +1678,7 @@ namespace MWMechanics
 
                     if (!cellChanged && worldScene->hasCellChanged())
                     {
+                        mActorsGrid.clear();
                         return; // for now abort update of the old cell when cell changes by teleportation magic effect
                                 // a better solution might be to apply cell changes at the end of the frame
                     }
@@ -1588,16 +1689,30 @@ namespace MWMechanics
                             if (!isPlayer)
                                 adjustCommandedActor(actor.getPtr());
 
-                            for (const Actor& otherActor : mActors)
+                            // engageCombat ignores actors out of processing range
+                            nearbyActors.clear();
+                            if (!isPlayer) // player is not AI-controlled
+                                getActorsInRange(actor.getPtr().getRefData().getPosition().asVec3(),
+                                    static_cast<float>(actorsProcessingRange), nearbyActors);
+                            for (const Actor* otherActor : nearbyActors)
                             {
-                                if (otherActor.getPtr() == actor.getPtr() || isPlayer) // player is not AI-controlled
+                                if (otherActor->getPtr() == actor.getPtr())
                                     continue;
-                                engageCombat(
-                                    actor.getPtr(), otherActor.getPtr(), cachedAllies, otherActor.getPtr() == player);
+                                engageCombat(actor.getPtr(), otherActor->getPtr(), cachedAllies,
+                                    otherActor->getPtr() == player);
                             }
                         }
                         if (mTimerUpdateHeadTrack == 0)
-                            updateHeadTracking(actor.getPtr(), mActors, isPlayer, ctrl);
+                        {
+                            // Actors in combat and pursuit track only their target
+                            const AiSequence& aiSequence
+                                = actor.getPtr().getClass().getCreatureStats(actor.getPtr()).getAiSequence();
+                            nearbyActors.clear();
+                            if (!aiSequence.isInCombat() && !aiSequence.isInPursuit())
+                                getActorsInRange(actor.getPtr().getRefData().getPosition().asVec3(),
+                                    getMaxHeadTrackDistance(), nearbyActors);
+                            updateHeadTracking(actor.getPtr(), nearbyActors, isPlayer, ctrl);
+                        }
 
                         if (actor.getPtr().getClass().isNpc() && !isPlayer)
                             updateCrimePursuit(actor.getPtr(), duration);
@@ -1607,7 +1722,24 @@ namespace MWMechanics
                             CreatureStats& stats = actor.getPtr().getClass().getCreatureStats(actor.getPtr());
                             if (isConscious(actor.getPtr()) && !(luaControls && luaControls->mDisableAI))
                             {
-                                stats.getAiSequence().execute(actor.getPtr(), ctrl, duration);
+                                // Spread updates of distant actors over frames by actor id
+                                const float aiDuration = actor.addAiDuration(duration);
+                                const int aiInterval = getAiUpdateInterval(actor.getPtr(), player, distSqr);
+                                if (aiInterval == 1
+                                    || (mAiUpdateFrame + static_cast<unsigned>(stats.getActorId())) % aiInterval == 0)
+                                {
+                                    stats.getAiSequence().execute(actor.getPtr(), ctrl, aiDuration);
+                                    actor.resetAiDuration();
+                                    actor.storeAiMovement(
+                                        actor.getPtr().getClass().getMovementSettings(actor.getPtr()));
+                                }
+                                else
+                                {
+                                    // CharacterController resets movement every frame, keep walking and turning
+                                    // until the next AI update
+                                    actor.restoreAiMovement(
+                                        actor.getPtr().getClass().getMovementSettings(actor.getPtr()));
+                                }
                                 updateGreetingState(actor.getPtr(), actor, mTimerUpdateHello > 0);
                                 playIdleDialogue(actor.getPtr());
                                 updateMovementSpeed(actor.getPtr());
@@ -1638,6 +1770,7 @@ namespace MWMechanics
             if (Settings::game().mNPCsAvoidCollisions)
                 predictAndAvoidCollisions(duration);
 
+            ++mAiUpdateFrame;
             mTimerUpdateHeadTrack += duration;
             mTimerUpdateEquippedLight += duration;
             mTimerUpdateHello += duration;
@@ -1734,6 +1867,7 @@ namespace MWMechanics
 
             killDeadActors();
             updateSneaking(playerCharacter, duration);
+            mActorsGrid.clear();
         }
 
         updateCombatMusic();
@@ -2046,24 +2180,49 @@ namespace MWMechanics
             actor.getCharacterController().persistAnimationState();
     }
 
-    void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out) const
+    void Actors::buildActorsGrid()
     {
+        mActorsGrid.clear();
         for (const Actor& actor : mActors)
-        {
-            if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius * radius)
-                out.push_back(actor.getPtr());
-        }
+            mActorsGrid.add(actor.getPtr().getRefData().getPosition().asVec3(), &actor);
+        mActorsGrid.build();
     }
 
-    bool Actors::isAnyObjectInRange(const osg::Vec3f& position, float radius) const
+    void Actors::getActorsInRange(const osg::Vec3f& position, float radius, std::vector<const Actor*>& out) const
     {
-        for (const Actor& actor : mActors)
+        const auto isInRange = [&](const Actor& actor) {
+            return (actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius * radius;
+        };
+
+        if (!mActorsGrid.isBuilt() || radius > maxActorsGridQueryRadius)
         {
-            if ((actor.getPtr().getRefData().getPosition().asVec3() - position).length2() <= radius * radius)
-                return true;
+            for (const Actor& actor : mActors)
+                if (isInRange(actor))
+                    out.push_back(&actor);
+            return;
         }
 
-        return false;
+        // Grid is used to find candidates, actors may have moved since it was built
+        mActorsGridIndices.clear();
+        mActorsGrid.findInRange(position, radius, mActorsGridIndices);
+        for (const std::size_t index : mActorsGridIndices)
+            if (isInRange(*mActorsGrid[index]))
+                out.push_back(mActorsGrid[index]);
+    }
+
+    void Actors::getObjectsInRange(const osg::Vec3f& position, float radius, std::vector<MWWorld::Ptr>& out) const
+    {
+        std::vector<const Actor*> actors;
+        getActorsInRange(position, radius, actors);
+        for (const Actor* actor : actors)
+            out.push_back(actor->getPtr());
+    }
+
+    bool Actors::isAnyObjectInRange(const osg::Vec3f& position, float radius) const
+    {
+        std::vector<const Actor*> actors;
+        getActorsInRange(position, radius, actors);
+        return !actors.empty();
     }
 
     std::vector<MWWorld::Ptr> Actors::getActorsSidingWith(const MWWorld::Ptr& actorPtr, bool excludeInfighting) const
@@ -2286,6 +2445,7 @@ namespace MWMechanics
 
     void Actors::clear()
     {
+        mActorsGrid.clear();
         mIndex.clear();
         mActors.clear();
         mDeathCount.clear();
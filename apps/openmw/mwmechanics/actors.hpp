@@ -3,10 +3,17 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
+#include <components/misc/jobpool.hpp>
+#include <components/misc/uniformgrid.hpp>
+
+#include <osg/Vec2f>
+#include <osg/Vec3f>
+
 #include "actor.hpp"
 
 namespace ESM
@@ -15,11 +22,6 @@ namespace ESM
     class ESMWriter;
 }
 
-namespace osg
-{
-    class Vec3f;
-}
-
 namespace Loading
 {
     class Listener;
@@ -172,14 +174,51 @@ namespace MWMechanics
             Battle
         };
 
+        struct PredictedCollision
+        {
+            std::size_t mOther;
+            float mTime;
+            float mAngle;
+            osg::Vec2f mMovementCorrection;
+        };
+
+        // State of an actor for collision avoidance captured before predictions run in parallel
+        struct CollisionAvoidance
+        {
+            MWWorld::Ptr mPtr;
+            osg::Vec3f mPosition;
+            float mRotZ = 0;
+            osg::Vec3f mHalfExtents;
+            float mMaxSpeed = 0;
+            osg::Vec3f mMovement;
+            bool mIsDead = false;
+            bool mIsMoving = false;
+            bool mShouldAvoid = false;
+            bool mShouldTurnToApproachingActor = false;
+            float mTimeToCheck = 0;
+            MWWorld::Ptr mCurrentTarget;
+            bool mCorrected = false;
+            std::vector<std::size_t> mNearby;
+            std::vector<PredictedCollision> mCollisions;
+        };
+
         std::map<ESM::RefId, int> mDeathCount;
         std::list<Actor> mActors;
         std::map<const MWWorld::LiveCellRefBase*, std::list<Actor>::iterator> mIndex;
+        // Actors positions at the beginning of update. Built only while update runs and dropped when the set of
+        // actors changes, proximity queries scan all actors then.
+        Misc::UniformGrid<const Actor*> mActorsGrid{ 512 };
+        mutable std::vector<std::size_t> mActorsGridIndices;
+        std::vector<CollisionAvoidance> mCollisionAvoidance;
+        Misc::UniformGrid<std::size_t> mCollisionAvoidanceGrid{ 512 };
+        // Created on first use, only collision avoidance runs on it
+        std::unique_ptr<Misc::JobPool> mJobPool;
         // We should add a delay between summoned creature death and its corpse despawning
         float mTimerDisposeSummonsCorpses = 0.2f;
         float mTimerUpdateHeadTrack = 0;
         float mTimerUpdateEquippedLight = 0;
         float mTimerUpdateHello = 0;
+        unsigned mAiUpdateFrame = 0;
         float mSneakTimer = 0; // Times update of sneak icon
         float mSneakSkillTimer = 0; // Times sneak skill progress from "avoid notice"
         MusicType mCurrentMusic = MusicType::Title;
@@ -196,7 +235,12 @@ namespace MWMechanics
 
         void purgeSpellEffects(int casterActorId) const;
 
-        void predictAndAvoidCollisions(float duration) const;
+        void predictAndAvoidCollisions(float duration);
+
+        void buildActorsGrid();
+
+        /// Appends actors within the radius in the order they are stored
+        void getActorsInRange(const osg::Vec3f& position, float radius, std::vector<const Actor*>& out) const;
 
         /** Start combat between two actors
             @Notes: If againstPlayer = true then actor2 should be the Player.
@@ -377,13 +377,13 @@ namespace MWMechanics
                         osg::Vec3f localPos = actor.getRefData().getPosition().asVec3();
                         coords.toLocal(localPos);
 
-                        int closestPointIndex = PathFinder::getClosestPoint(pathgrid, localPos);
-                        for (int i = 0; i < static_cast<int>(pathgrid->mPoints.size()); i++)
+                        const PathgridGraph& pathgridGraph = getPathGridGraph(pathgrid);
+                        const size_t closestPointIndex = pathgridGraph.getClosestPoint(localPos);
+                        for (size_t i = 0; i < pathgrid->mPoints.size(); i++)
                         {
-                            if (i != closestPointIndex
-                                && getPathGridGraph(pathgrid).isPointConnected(closestPointIndex, i))
+                            if (i != closestPointIndex && pathgridGraph.isPointConnected(closestPointIndex, i))
                             {
-                                points.push_back(pathgrid->mPoints[static_cast<size_t>(i)]);
+                                points.push_back(pathgrid->mPoints[i]);
                             }
                         }
 
@@ -210,7 +210,8 @@ namespace MWMechanics
             MWWorld::Ptr bestBolt;
             float bestBoltRating = rateAmmo(actor, enemy, bestBolt, ESM::Weapon::Bolt);
 
-            for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+            for (MWWorld::ContainerStoreIterator it = store.begin(MWWorld::ContainerStore::Type_Weapon);
+                 it != store.end(); ++it)
             {
                 float rating = rateWeapon(*it, actor, enemy, -1, bestArrowRating, bestBoltRating);
                 if (rating > bestActionRating)
@@ -279,7 +280,8 @@ namespace MWMechanics
 
             float bestBoltRating = rateAmmo(actor, enemy, ESM::Weapon::Bolt);
 
-            for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+            for (MWWorld::ContainerStoreIterator it = store.begin(MWWorld::ContainerStore::Type_Weapon);
+                 it != store.end(); ++it)
             {
                 float rating = rateWeapon(*it, actor, enemy, -1, bestArrowRating, bestBoltRating);
                 if (rating > bestActionRating)
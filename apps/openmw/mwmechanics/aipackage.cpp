@@ -153,16 +153,21 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
 
         if (!mIsShortcutting)
         {
-            if (wasShortcutting || doesPathNeedRecalc(dest, actor)) // if need to rebuild path
+            // if need to rebuild path or the one requested before may be ready
+            if (wasShortcutting || doesPathNeedRecalc(dest, actor) || mPathFinder.hasPendingPath())
             {
                 const ESM::Pathgrid* pathgrid
                     = world->getStore().get<ESM::Pathgrid>().search(*actor.getCell()->getCell());
-                mPathFinder.buildLimitedPath(actor, position, dest, actor.getCell(), getPathGridGraph(pathgrid),
-                    agentBounds, getNavigatorFlags(actor), getAreaCosts(actor), endTolerance, pathType);
-                mRotateOnTheRunChecks = 3;
+                // Existing path is followed while the new one is being found in background
+                const bool pathChanged = mPathFinder.requestLimitedPath(actor, position, dest, actor.getCell(),
+                    getPathGridGraph(pathgrid), agentBounds, getNavigatorFlags(actor), getAreaCosts(actor),
+                    endTolerance, pathType);
+
+                if (pathChanged)
+                    mRotateOnTheRunChecks = 3;
 
                 // give priority to go directly on target if there is minimal opportunity
-                if (destInLOS && mPathFinder.getPath().size() > 1)
+                if (pathChanged && destInLOS && mPathFinder.getPath().size() > 1)
                 {
                     // get point just before dest
                     auto pPointBeforeDest = mPathFinder.getPath().rbegin() + 1;
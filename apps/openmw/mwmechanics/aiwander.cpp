@@ -808,9 +808,10 @@ namespace MWMechanics
         if (pathgrid == nullptr || pathgrid->mPoints.empty())
             return;
 
-        int index = PathFinder::getClosestPoint(pathgrid, PathFinder::makeOsgVec3(dest));
+        const PathgridGraph& pathgridGraph = getPathGridGraph(pathgrid);
+        const size_t index = pathgridGraph.getClosestPoint(PathFinder::makeOsgVec3(dest));
 
-        getPathGridGraph(pathgrid).getNeighbouringPoints(index, points);
+        pathgridGraph.getNeighbouringPoints(index, points);
     }
 
     void AiWander::getAllowedNodes(const MWWorld::Ptr& actor, AiWanderStorage& storage)
@@ -841,7 +842,8 @@ namespace MWMechanics
             const osg::Vec3f npcPos = converter.toLocalVec3(mInitialActorPosition);
 
             // Find closest pathgrid point
-            int closestPointIndex = PathFinder::getClosestPoint(pathgrid, npcPos);
+            const PathgridGraph& pathgridGraph = getPathGridGraph(pathgrid);
+            const size_t closestPointIndex = pathgridGraph.getClosestPoint(npcPos);
 
             // mAllowedNodes for this actor with pathgrid point indexes based on mDistance
             // and if the point is connected to the closest current point
@@ -851,7 +853,7 @@ namespace MWMechanics
             {
                 osg::Vec3f nodePos(PathFinder::makeOsgVec3(pathgrid->mPoints[counter]));
                 if ((npcPos - nodePos).length2() <= mDistance * mDistance
-                    && getPathGridGraph(pathgrid).isPointConnected(closestPointIndex, counter))
+                    && pathgridGraph.isPointConnected(closestPointIndex, counter))
                 {
                     storage.mAllowedNodes.push_back(converter.toWorldPoint(pathgrid->mPoints[counter]));
                     pointIndex = counter;
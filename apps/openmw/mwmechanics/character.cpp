@@ -1208,13 +1208,21 @@ namespace MWMechanics
         return mAnimation->updateCarriedLeftVisible(weaptype);
     }
 
+    float CharacterController::getTextKeyTime(std::initializer_list<std::string_view> textKeyParts) const
+    {
+        mTextKeyBuffer.clear();
+        for (std::string_view part : textKeyParts)
+            mTextKeyBuffer += part;
+        return mAnimation->getTextKeyTime(mTextKeyBuffer);
+    }
+
     float CharacterController::calculateWindUp() const
     {
         if (mCurrentWeapon.empty() || mWeaponType == ESM::Weapon::PickProbe || isRandomAttackAnimation(mCurrentWeapon))
             return -1.f;
 
-        float minAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + " min attack");
-        float maxAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + " max attack");
+        float minAttackTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " min attack" });
+        float maxAttackTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " max attack" });
         if (minAttackTime == -1.f || minAttackTime >= maxAttackTime)
             return -1.f;
 
@@ -1374,7 +1382,7 @@ namespace MWMechanics
                     mAnimation->detachArrow();
 
                     // If we do not have the "unequip detach" key, hide weapon manually.
-                    if (mAnimation->getTextKeyTime(weapgroup + ": unequip detach") < 0)
+                    if (getTextKeyTime({ weapgroup, ": unequip detach" }) < 0)
                         mAnimation->showWeapons(false);
                 }
 
@@ -1427,7 +1435,7 @@ namespace MWMechanics
 
                             // If we do not have the "equip attach" key, show weapon manually.
                             if (weaptype != ESM::Weapon::Spell
-                                && mAnimation->getTextKeyTime(weapgroup + ": equip attach") < 0)
+                                && getTextKeyTime({ weapgroup, ": equip attach" }) < 0)
                             {
                                 mAnimation->showWeapons(true);
                             }
@@ -1727,8 +1735,8 @@ namespace MWMechanics
             // The release state might have been reached before reaching the wind-up section. We'll play the new section
             // only when the wind-up section is reached.
             float currentTime = mAnimation->getCurrentTime(mCurrentWeapon);
-            float minAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + " min attack");
-            float maxAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + " max attack");
+            float minAttackTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " min attack" });
+            float maxAttackTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " max attack" });
             if (minAttackTime <= currentTime && currentTime <= maxAttackTime)
             {
                 std::string hit = mAttackType != "shoot" ? "hit" : "release";
@@ -1739,8 +1747,8 @@ namespace MWMechanics
                 if (minAttackTime != -1.f && minAttackTime < maxAttackTime)
                 {
                     startPoint = 1.f - mAttackStrength;
-                    float minHitTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + " min hit");
-                    float hitTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + ' ' + hit);
+                    float minHitTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " min hit" });
+                    float hitTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " ", hit });
                     if (maxAttackTime <= minHitTime && minHitTime < hitTime)
                         startPoint *= (minHitTime - maxAttackTime) / (hitTime - maxAttackTime);
                 }
@@ -1824,8 +1832,8 @@ namespace MWMechanics
             if (mUpperBodyState == UpperBodyState::AttackWindUp && !isRandomAttackAnimation(mCurrentWeapon))
             {
                 float currentTime = mAnimation->getCurrentTime(mCurrentWeapon);
-                float minAttackTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + " min attack");
-                float startTime = mAnimation->getTextKeyTime(mCurrentWeapon + ": " + mAttackType + " start");
+                float minAttackTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " min attack" });
+                float startTime = getTextKeyTime({ mCurrentWeapon, ": ", mAttackType, " start" });
                 if (startTime <= currentTime && currentTime < minAttackTime)
                     mAnimation->setPitchFactor((currentTime - startTime) / (minAttackTime - startTime));
             }
@@ -2471,8 +2479,8 @@ namespace MWMechanics
             float complete = anim.mTime;
             if (anim.mAbsolute)
             {
-                float start = mAnimation->getTextKeyTime(anim.mGroup + ": start");
-                float stop = mAnimation->getTextKeyTime(anim.mGroup + ": stop");
+                float start = getTextKeyTime({ anim.mGroup, ": start" });
+                float stop = getTextKeyTime({ anim.mGroup, ": stop" });
                 float time = std::clamp(anim.mTime, start, stop);
                 complete = (time - start) / (stop - start);
             }
@@ -2501,13 +2509,13 @@ namespace MWMechanics
         // This emulates observed behavior from the original allows the script "OutsideBanner" to animate banners
         // correctly.
         if (!mAnimQueue.empty() && mAnimQueue.front().mGroup == groupname
-            && mAnimation->getTextKeyTime(mAnimQueue.front().mGroup + ": loop start") >= 0
+            && getTextKeyTime({ mAnimQueue.front().mGroup, ": loop start" }) >= 0
             && mAnimation->isPlaying(groupname))
         {
-            float endOfLoop = mAnimation->getTextKeyTime(mAnimQueue.front().mGroup + ": loop stop");
+            float endOfLoop = getTextKeyTime({ mAnimQueue.front().mGroup, ": loop stop" });
 
             if (endOfLoop < 0) // if no Loop Stop key was found, use the Stop key
-                endOfLoop = mAnimation->getTextKeyTime(mAnimQueue.front().mGroup + ": stop");
+                endOfLoop = getTextKeyTime({ mAnimQueue.front().mGroup, ": stop" });
 
             if (endOfLoop > 0 && (mAnimation->getCurrentTime(mAnimQueue.front().mGroup) < endOfLoop))
             {
@@ -2,6 +2,9 @@
 #define GAME_MWMECHANICS_CHARACTER_HPP
 
 #include <deque>
+#include <initializer_list>
+#include <string>
+#include <string_view>
 
 #include <components/esm3/loadweap.hpp>
 
@@ -191,8 +194,13 @@ namespace MWMechanics
         bool mIsMovingBackward{ false };
         osg::Vec2f mSmoothedSpeed;
 
+        // Reused to build text keys without allocating on every lookup
+        mutable std::string mTextKeyBuffer;
+
         std::string_view getMovementBasedAttackType() const;
 
+        float getTextKeyTime(std::initializer_list<std::string_view> textKeyParts) const;
+
         void clearStateAnimation(std::string& anim) const;
         void resetCurrentJumpState();
         void resetCurrentMovementState();
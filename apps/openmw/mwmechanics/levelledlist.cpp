@@ -1,9 +1,10 @@
 #include <components/debug/debuglog.hpp>
 #include <components/esm3/loadlevlist.hpp>
 
+#include <algorithm>
+
 #include "../mwworld/class.hpp"
 #include "../mwworld/esmstore.hpp"
-#include "../mwworld/manualref.hpp"
 #include "../mwworld/ptr.hpp"
 
 #include "../mwbase/environment.hpp"
@@ -14,68 +15,87 @@
 
 namespace MWMechanics
 {
-
-    ESM::RefId getLevelledItem(
-        const ESM::LevelledListBase* levItem, bool creature, Misc::Rng::Generator& prng, std::optional<int> level)
+    namespace
     {
-        const std::vector<ESM::LevelledListBase::LevelItem>& items = levItem->mList;
-
-        int playerLevel;
-        if (level.has_value())
-            playerLevel = *level;
-        else
+        const ESM::RefId* pickLevelledItem(
+            const ESM::LevelledListBase& levItem, bool creature, int playerLevel, Misc::Rng::Generator& prng)
         {
-            const MWWorld::Ptr& player = getPlayer();
-            playerLevel = player.getClass().getCreatureStats(player).getLevel();
-            level = playerLevel;
-        }
+            if (Misc::Rng::roll0to99(prng) < levItem.mChanceNone)
+                return nullptr;
 
-        if (Misc::Rng::roll0to99(prng) < levItem->mChanceNone)
-            return ESM::RefId();
+            const std::vector<ESM::LevelledListBase::LevelItem>& items = levItem.mList;
 
-        std::vector<const ESM::RefId*> candidates;
-        int highestLevel = 0;
-        for (const auto& levelledItem : items)
-        {
-            if (levelledItem.mLevel > highestLevel && levelledItem.mLevel <= playerLevel)
-                highestLevel = levelledItem.mLevel;
-        }
+            int highestLevel = 0;
+            for (const auto& levelledItem : items)
+            {
+                if (levelledItem.mLevel > highestLevel && levelledItem.mLevel <= playerLevel)
+                    highestLevel = levelledItem.mLevel;
+            }
 
-        // For levelled creatures, the flags are swapped. This file format just makes so much sense.
-        bool allLevels = (levItem->mFlags & ESM::ItemLevList::AllLevels) != 0;
-        if (creature)
-            allLevels = levItem->mFlags & ESM::CreatureLevList::AllLevels;
+            // For levelled creatures, the flags are swapped. This file format just makes so much sense.
+            bool allLevels = (levItem.mFlags & ESM::ItemLevList::AllLevels) != 0;
+            if (creature)
+                allLevels = levItem.mFlags & ESM::CreatureLevList::AllLevels;
 
-        for (const auto& levelledItem : items)
-        {
-            if (playerLevel >= levelledItem.mLevel && (allLevels || levelledItem.mLevel == highestLevel))
-                candidates.push_back(&levelledItem.mId);
-        }
-        if (candidates.empty())
-            return ESM::RefId();
-        const ESM::RefId& item = *candidates[Misc::Rng::rollDice(candidates.size(), prng)];
+            const auto isCandidate = [&](const ESM::LevelledListBase::LevelItem& levelledItem) {
+                return playerLevel >= levelledItem.mLevel && (allLevels || levelledItem.mLevel == highestLevel);
+            };
 
-        // Vanilla doesn't fail on nonexistent items in levelled lists
-        if (!MWBase::Environment::get().getESMStore()->find(item))
-        {
-            Log(Debug::Warning) << "Warning: ignoring nonexistent item " << item << " in levelled list "
-                                << levItem->mId;
-            return ESM::RefId();
-        }
+            const int candidates = static_cast<int>(std::count_if(items.begin(), items.end(), isCandidate));
+            if (candidates == 0)
+                return nullptr;
 
-        // Is this another levelled item or a real item?
-        MWWorld::ManualRef ref(*MWBase::Environment::get().getESMStore(), item, 1);
-        if (ref.getPtr().getType() != ESM::ItemLevList::sRecordId
-            && ref.getPtr().getType() != ESM::CreatureLevList::sRecordId)
-        {
-            return item;
+            int index = Misc::Rng::rollDice(candidates, prng);
+            for (const auto& levelledItem : items)
+            {
+                if (isCandidate(levelledItem) && index-- == 0)
+                    return &levelledItem.mId;
+            }
+            return nullptr;
         }
-        else
+    }
+
+    int getLevelledListLevel()
+    {
+        const MWWorld::Ptr& player = getPlayer();
+        return player.getClass().getCreatureStats(player).getLevel();
+    }
+
+    ESM::RefId getLevelledItem(
+        const ESM::LevelledListBase* levItem, bool creature, Misc::Rng::Generator& prng, std::optional<int> level)
+    {
+        const int playerLevel = level.has_value() ? *level : getLevelledListLevel();
+        const MWWorld::ESMStore& store = *MWBase::Environment::get().getESMStore();
+
+        // Nested lists are resolved in place, looking up only the record type of each picked id
+        while (true)
         {
-            if (ref.getPtr().getType() == ESM::ItemLevList::sRecordId)
-                return getLevelledItem(ref.getPtr().get<ESM::ItemLevList>()->mBase, false, prng, level);
+            const ESM::RefId* item = pickLevelledItem(*levItem, creature, playerLevel, prng);
+            if (item == nullptr)
+                return ESM::RefId();
+
+            // Vanilla doesn't fail on nonexistent items in levelled lists
+            const int type = store.find(*item);
+            if (type == 0)
+            {
+                Log(Debug::Warning) << "Warning: ignoring nonexistent item " << *item << " in levelled list "
+                                    << levItem->mId;
+                return ESM::RefId();
+            }
+
+            // Is this another levelled item or a real item?
+            if (type == ESM::ItemLevList::sRecordId)
+            {
+                levItem = store.get<ESM::ItemLevList>().find(*item);
+                creature = false;
+            }
+            else if (type == ESM::CreatureLevList::sRecordId)
+            {
+                levItem = store.get<ESM::CreatureLevList>().find(*item);
+                creature = true;
+            }
             else
-                return getLevelledItem(ref.getPtr().get<ESM::CreatureLevList>()->mBase, true, prng, level);
+                return *item;
         }
     }
 }
@@ -14,6 +14,9 @@ namespace ESM
 namespace MWMechanics
 {
 
+    /// @return level used to resolve levelled lists when none is given
+    int getLevelledListLevel();
+
     /// @return ID of resulting item, or empty if none
     ESM::RefId getLevelledItem(
         const ESM::LevelledListBase* levItem, bool creature, Misc::Rng::Generator& prng, std::optional<int> level = {});
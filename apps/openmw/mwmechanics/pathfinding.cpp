@@ -1,5 +1,8 @@
 #include "pathfinding.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
 #include <iterator>
 #include <limits>
 
@@ -24,47 +27,6 @@
 
 namespace
 {
-    // Chooses a reachable end pathgrid point.  start is assumed reachable.
-    std::pair<int, bool> getClosestReachablePoint(
-        const ESM::Pathgrid* grid, const MWMechanics::PathgridGraph* graph, const osg::Vec3f& pos, int start)
-    {
-        assert(grid && !grid->mPoints.empty());
-
-        float closestDistanceBetween = std::numeric_limits<float>::max();
-        float closestDistanceReachable = std::numeric_limits<float>::max();
-        int closestIndex = 0;
-        int closestReachableIndex = 0;
-        // TODO: if this full scan causes performance problems mapping pathgrid
-        //       points to a quadtree may help
-        for (size_t counter = 0; counter < grid->mPoints.size(); counter++)
-        {
-            float potentialDistBetween = MWMechanics::PathFinder::distanceSquared(grid->mPoints[counter], pos);
-            if (potentialDistBetween < closestDistanceReachable)
-            {
-                // found a closer one
-                if (graph->isPointConnected(start, counter))
-                {
-                    closestDistanceReachable = potentialDistBetween;
-                    closestReachableIndex = counter;
-                }
-                if (potentialDistBetween < closestDistanceBetween)
-                {
-                    closestDistanceBetween = potentialDistBetween;
-                    closestIndex = counter;
-                }
-            }
-        }
-
-        // post-condition: start and endpoint must be connected
-        assert(graph->isPointConnected(start, closestReachableIndex));
-
-        // AiWander has logic that depends on whether a path was created, deleting
-        // allowed nodes if not.  Hence a path needs to be created even if the start
-        // and the end points are the same.
-
-        return std::pair<int, bool>(closestReachableIndex, closestReachableIndex == closestIndex);
-    }
-
     float sqrDistance(const osg::Vec2f& lhs, const osg::Vec2f& rhs)
     {
         return (lhs - rhs).length2();
@@ -75,6 +37,19 @@ namespace
         return sqrDistance(osg::Vec2f(lhs.x(), lhs.y()), osg::Vec2f(rhs.x(), rhs.y()));
     }
 
+    // Same as the destination change making AiPackage to rebuild the path
+    constexpr float maxPendingPathEndDeviation = 10;
+
+    // Path found in background is used only when it was requested for the same destination and the actor is still
+    // near the point the path begins with
+    bool isPendingPathValid(const osg::Vec3f& requestedStart, const osg::Vec3f& requestedEnd, const osg::Vec3f& start,
+        const osg::Vec3f& end, const DetourNavigator::AgentBounds& agentBounds)
+    {
+        const float maxStartDeviation = std::max(agentBounds.mHalfExtents.x(), agentBounds.mHalfExtents.y());
+        return sqrDistanceIgnoreZ(requestedStart, start) <= maxStartDeviation * maxStartDeviation
+            && (requestedEnd - end).length2() <= maxPendingPathEndDeviation * maxPendingPathEndDeviation;
+    }
+
     float getHeight(const MWWorld::ConstPtr& actor)
     {
         const auto world = MWBase::Environment::get().getWorld();
@@ -114,6 +89,49 @@ namespace
                 && std::abs((position.value() - start).length2() - (end - start).length2()) <= 1;
         }
     };
+
+    DetourNavigator::Status handleNavigatorStatus(DetourNavigator::Navigator& navigator,
+        DetourNavigator::Status status, const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const DetourNavigator::AgentBounds& agentBounds,
+        const DetourNavigator::Flags flags, MWMechanics::PathType pathType)
+    {
+        switch (status)
+        {
+            case DetourNavigator::Status::PartialPath:
+            case DetourNavigator::Status::StartPolygonNotFound:
+            case DetourNavigator::Status::EndPolygonNotFound:
+                // Path may go through tiles which are not generated yet
+                navigator.prioritizeTiles(agentBounds, startPoint, endPoint);
+                break;
+            default:
+                break;
+        }
+
+        if (pathType == MWMechanics::PathType::Partial && status == DetourNavigator::Status::PartialPath)
+            return DetourNavigator::Status::Success;
+
+        if (status != DetourNavigator::Status::Success)
+        {
+            Log(Debug::Debug) << "Build path by navigator error: \"" << DetourNavigator::getMessage(status)
+                              << "\" for \"" << actor.getClass().getName(actor) << "\" (" << actor.getBase()
+                              << ") from " << startPoint << " to " << endPoint << " with flags ("
+                              << DetourNavigator::WriteFlags{ flags } << ")";
+        }
+
+        return status;
+    }
+
+    osg::Vec3f getLimitedEndPoint(
+        const DetourNavigator::Navigator& navigator, const osg::Vec3f& startPoint, const osg::Vec3f& endPoint)
+    {
+        const auto maxDistance
+            = std::min(navigator.getMaxNavmeshAreaRealRadius(), static_cast<float>(Constants::CellSizeInUnits));
+        const auto startToEnd = endPoint - startPoint;
+        const auto distance = startToEnd.length();
+        if (distance <= maxDistance)
+            return endPoint;
+        return startPoint + startToEnd * maxDistance / distance;
+    }
 }
 
 namespace MWMechanics
@@ -151,7 +169,7 @@ namespace MWMechanics
      *
      * NOTE: startPoint & endPoint are in world coordinates
      *
-     * Updates mPath using aStarSearch() or ray test (if shortcut allowed).
+     * Updates mPath using findPath() or ray test (if shortcut allowed).
      * mPath consists of pathgrid points, except the last element which is
      * endPoint.  This may be useful where the endPoint is not on a pathgrid
      * point (e.g. combat).  However, if the caller has already chosen a
@@ -197,11 +215,14 @@ namespace MWMechanics
         //       point right behind the wall that is closer than any pathgrid
         //       point outside the wall
         osg::Vec3f startPointInLocalCoords(converter.toLocalVec3(startPoint));
-        int startNode = getClosestPoint(pathgrid, startPointInLocalCoords);
+        const size_t startNode = pathgridGraph.getClosestPoint(startPointInLocalCoords);
 
+        // AiWander has logic that depends on whether a path was created, deleting
+        // allowed nodes if not.  Hence a path needs to be created even if the start
+        // and the end points are the same.
         osg::Vec3f endPointInLocalCoords(converter.toLocalVec3(endPoint));
-        std::pair<int, bool> endNode
-            = getClosestReachablePoint(pathgrid, &pathgridGraph, endPointInLocalCoords, startNode);
+        const std::pair<size_t, bool> endNode
+            = pathgridGraph.getClosestReachablePoint(endPointInLocalCoords, startNode);
 
         // if it's shorter for actor to travel from start to end, than to travel from either
         // start or end to nearest pathgrid point, just travel from start to end.
@@ -214,55 +235,44 @@ namespace MWMechanics
             return;
         }
 
-        // AiWander has logic that depends on whether a path was created,
-        // deleting allowed nodes if not.  Hence a path needs to be created
-        // even if the start and the end points are the same.
-        // NOTE: aStarSearch will return an empty path if the start and end
+        // NOTE: findPath returns a path with a single point if the start and end
         //       nodes are the same
-        if (startNode == endNode.first)
-        {
-            ESM::Pathgrid::Point temp(pathgrid->mPoints[startNode]);
-            converter.toWorld(temp);
-            *out++ = makeOsgVec3(temp);
-        }
-        else
-        {
-            auto path = pathgridGraph.aStarSearch(startNode, endNode.first);
+        std::vector<size_t> path = pathgridGraph.findPath(startNode, endNode.first);
 
-            // If nearest path node is in opposite direction from second, remove it from path.
-            // Especially useful for wandering actors, if the nearest node is blocked for some reason.
-            if (path.size() > 1)
+        // If nearest path node is in opposite direction from second, remove it from path.
+        // Especially useful for wandering actors, if the nearest node is blocked for some reason.
+        if (path.size() > 1)
+        {
+            const ESM::Pathgrid::Point& secondNode = pathgrid->mPoints[path[1]];
+            osg::Vec3f firstNodeVec3f = makeOsgVec3(pathgrid->mPoints[startNode]);
+            osg::Vec3f secondNodeVec3f = makeOsgVec3(secondNode);
+            osg::Vec3f toSecondNodeVec3f = secondNodeVec3f - firstNodeVec3f;
+            osg::Vec3f toStartPointVec3f = startPointInLocalCoords - firstNodeVec3f;
+            if (toSecondNodeVec3f * toStartPointVec3f > 0)
             {
-                ESM::Pathgrid::Point secondNode = *(++path.begin());
-                osg::Vec3f firstNodeVec3f = makeOsgVec3(pathgrid->mPoints[startNode]);
-                osg::Vec3f secondNodeVec3f = makeOsgVec3(secondNode);
-                osg::Vec3f toSecondNodeVec3f = secondNodeVec3f - firstNodeVec3f;
-                osg::Vec3f toStartPointVec3f = startPointInLocalCoords - firstNodeVec3f;
-                if (toSecondNodeVec3f * toStartPointVec3f > 0)
-                {
-                    ESM::Pathgrid::Point temp(secondNode);
-                    converter.toWorld(temp);
-                    // Add Z offset since path node can overlap with other objects.
-                    // Also ignore doors in raytesting.
-                    const int mask = MWPhysics::CollisionType_World;
-                    bool isPathClear = !MWBase::Environment::get()
-                                            .getWorld()
-                                            ->getRayCasting()
-                                            ->castRay(osg::Vec3f(startPoint.x(), startPoint.y(), startPoint.z() + 16),
-                                                osg::Vec3f(temp.mX, temp.mY, temp.mZ + 16), mask)
-                                            .mHit;
-                    if (isPathClear)
-                        path.pop_front();
-                }
+                ESM::Pathgrid::Point temp(secondNode);
+                converter.toWorld(temp);
+                // Add Z offset since path node can overlap with other objects.
+                // Also ignore doors in raytesting.
+                const int mask = MWPhysics::CollisionType_World;
+                bool isPathClear = !MWBase::Environment::get()
+                                        .getWorld()
+                                        ->getRayCasting()
+                                        ->castRay(osg::Vec3f(startPoint.x(), startPoint.y(), startPoint.z() + 16),
+                                            osg::Vec3f(temp.mX, temp.mY, temp.mZ + 16), mask)
+                                        .mHit;
+                if (isPathClear)
+                    path.erase(path.begin());
             }
-
-            // convert supplied path to world coordinates
-            std::transform(path.begin(), path.end(), out, [&](ESM::Pathgrid::Point& point) {
-                converter.toWorld(point);
-                return makeOsgVec3(point);
-            });
         }
 
+        // convert supplied path to world coordinates
+        std::transform(path.begin(), path.end(), out, [&](size_t index) {
+            ESM::Pathgrid::Point point(pathgrid->mPoints[index]);
+            converter.toWorld(point);
+            return makeOsgVec3(point);
+        });
+
         // If endNode found is NOT the closest PathGrid point to the endPoint,
         // assume endPoint is not reachable from endNode. In which case,
         // path ends at endNode.
@@ -354,6 +364,7 @@ namespace MWMechanics
 
     void PathFinder::buildStraightPath(const osg::Vec3f& endPoint)
     {
+        mPendingPath = {};
         mPath.clear();
         mPath.push_back(endPoint);
         mConstructed = true;
@@ -362,6 +373,7 @@ namespace MWMechanics
     void PathFinder::buildPathByPathgrid(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
         const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph)
     {
+        mPendingPath = {};
         mPath.clear();
         mCell = cell;
 
@@ -374,6 +386,7 @@ namespace MWMechanics
         const osg::Vec3f& endPoint, const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
+        mPendingPath = {};
         mPath.clear();
 
         // If it's not possible to build path over navmesh due to disabled navmesh generation fallback to straight path
@@ -394,6 +407,7 @@ namespace MWMechanics
         const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
+        mPendingPath = {};
         mPath.clear();
         mCell = cell;
 
@@ -407,6 +421,15 @@ namespace MWMechanics
                 mPath.clear();
         }
 
+        buildFallbackPath(
+            actor, startPoint, endPoint, pathgridGraph, agentBounds, flags, areaCosts, endTolerance, pathType, status);
+    }
+
+    void PathFinder::buildFallbackPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const PathgridGraph& pathgridGraph, const DetourNavigator::AgentBounds& agentBounds,
+        const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts, float endTolerance,
+        PathType pathType, DetourNavigator::Status status)
+    {
         if (status != DetourNavigator::Status::NavMeshNotFound && mPath.empty()
             && (flags & DetourNavigator::Flag_usePathgrid) == 0)
         {
@@ -435,19 +458,7 @@ namespace MWMechanics
         const auto navigator = world->getNavigator();
         const auto status = DetourNavigator::findPath(
             *navigator, agentBounds, startPoint, endPoint, flags, areaCosts, endTolerance, out);
-
-        if (pathType == PathType::Partial && status == DetourNavigator::Status::PartialPath)
-            return DetourNavigator::Status::Success;
-
-        if (status != DetourNavigator::Status::Success)
-        {
-            Log(Debug::Debug) << "Build path by navigator error: \"" << DetourNavigator::getMessage(status)
-                              << "\" for \"" << actor.getClass().getName(actor) << "\" (" << actor.getBase()
-                              << ") from " << startPoint << " to " << endPoint << " with flags ("
-                              << DetourNavigator::WriteFlags{ flags } << ")";
-        }
-
-        return status;
+        return handleNavigatorStatus(*navigator, status, actor, startPoint, endPoint, agentBounds, flags, pathType);
     }
 
     void PathFinder::buildLimitedPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
@@ -456,14 +467,79 @@ namespace MWMechanics
         const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
     {
         const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
-        const auto maxDistance
-            = std::min(navigator->getMaxNavmeshAreaRealRadius(), static_cast<float>(Constants::CellSizeInUnits));
-        const auto startToEnd = endPoint - startPoint;
-        const auto distance = startToEnd.length();
-        if (distance <= maxDistance)
-            return buildPath(actor, startPoint, endPoint, cell, pathgridGraph, agentBounds, flags, areaCosts,
-                endTolerance, pathType);
-        const auto end = startPoint + startToEnd * maxDistance / distance;
+        const osg::Vec3f end = getLimitedEndPoint(*navigator, startPoint, endPoint);
         buildPath(actor, startPoint, end, cell, pathgridGraph, agentBounds, flags, areaCosts, endTolerance, pathType);
     }
+
+    bool PathFinder::requestLimitedPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+        const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+        const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+        const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType)
+    {
+        const auto world = MWBase::Environment::get().getWorld();
+        const auto navigator = world->getNavigator();
+
+        if (mPendingPath.valid())
+        {
+            if (mPendingPath.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+
+            if (cell == mCell && isPendingPathValid(mPendingStart, mPendingEnd, startPoint, endPoint, agentBounds))
+            {
+                try
+                {
+                    // Copy the result, it is released together with mPendingPath
+                    const DetourNavigator::PathQueryResult result = mPendingPath.get();
+                    const osg::Vec3f limitedEnd = getLimitedEndPoint(*navigator, startPoint, endPoint);
+                    const DetourNavigator::Status status = handleNavigatorStatus(
+                        *navigator, result.mStatus, actor, startPoint, limitedEnd, agentBounds, flags, pathType);
+                    mPendingPath = {};
+                    mPath.clear();
+                    if (status == DetourNavigator::Status::Success)
+                    {
+                        mPath.assign(result.mPath.begin(), result.mPath.end());
+                        mConstructed = !mPath.empty();
+                        return true;
+                    }
+                    // Navmesh query with the same flags has just failed, don't repeat it
+                    buildFallbackPath(actor, startPoint, limitedEnd, pathgridGraph, agentBounds, flags, areaCosts,
+                        endTolerance, pathType, status);
+                    return true;
+                }
+                catch (const std::exception& e)
+                {
+                    Log(Debug::Warning) << "Failed to find path in background for \"" << actor.getClass().getName(actor)
+                                        << "\" (" << actor.getBase() << ") from " << startPoint << " to " << endPoint
+                                        << ": " << e.what();
+                }
+            }
+
+            // Result is outdated or not available, find the path again
+            buildLimitedPath(actor, startPoint, endPoint, cell, pathgridGraph, agentBounds, flags, areaCosts,
+                endTolerance, pathType);
+            return true;
+        }
+
+        DetourNavigator::PathQueryService* const service = world->getPathQueryService();
+        if (service == nullptr || !isPathConstructed() || cell != mCell || actor.getClass().isPureWaterCreature(actor)
+            || actor.getClass().isPureFlyingCreature(actor))
+        {
+            buildLimitedPath(actor, startPoint, endPoint, cell, pathgridGraph, agentBounds, flags, areaCosts,
+                endTolerance, pathType);
+            return true;
+        }
+
+        const DetourNavigator::PathQuery query{
+            .mAgentBounds = agentBounds,
+            .mStart = startPoint,
+            .mEnd = getLimitedEndPoint(*navigator, startPoint, endPoint),
+            .mIncludeFlags = flags,
+            .mAreaCosts = areaCosts,
+            .mEndTolerance = endTolerance,
+        };
+        mPendingPath = service->post(query).share();
+        mPendingStart = startPoint;
+        mPendingEnd = endPoint;
+        return false;
+    }
 }
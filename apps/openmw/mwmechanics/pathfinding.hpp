@@ -7,6 +7,7 @@
 
 #include <components/detournavigator/areatype.hpp>
 #include <components/detournavigator/flags.hpp>
+#include <components/detournavigator/pathqueryservice.hpp>
 #include <components/detournavigator/status.hpp>
 #include <components/esm/defs.hpp>
 #include <components/esm3/loadpgrd.hpp>
@@ -98,6 +99,7 @@ namespace MWMechanics
             mConstructed = false;
             mPath.clear();
             mCell = nullptr;
+            mPendingPath = {};
         }
 
         void buildStraightPath(const osg::Vec3f& endPoint);
@@ -120,6 +122,16 @@ namespace MWMechanics
             const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
             const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType);
 
+        /// Same as buildLimitedPath but for already constructed path requests a new path over navmesh from the path
+        /// query service and keeps the current one until the result is ready. Following calls apply the result or
+        /// try pathgrid if navmesh path is not found. Returns true when the path is changed.
+        bool requestLimitedPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+            const osg::Vec3f& endPoint, const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph,
+            const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+            const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType);
+
+        bool hasPendingPath() const { return mPendingPath.valid(); }
+
         /// Remove front point if exist and within tolerance
         void update(const osg::Vec3f& position, float pointTolerance, float destinationTolerance,
             UpdateFlags updateFlags, const DetourNavigator::AgentBounds& agentBounds, DetourNavigator::Flags pathFlags);
@@ -172,38 +184,13 @@ namespace MWMechanics
             return (MWMechanics::PathFinder::makeOsgVec3(point) - pos).length2();
         }
 
-        // Return the closest pathgrid point index from the specified position
-        // coordinates.  NOTE: Does not check if there is a sensible way to get there
-        // (e.g. a cliff in front).
-        //
-        // NOTE: pos is expected to be in local coordinates, as is grid->mPoints
-        //
-        static int getClosestPoint(const ESM::Pathgrid* grid, const osg::Vec3f& pos)
-        {
-            assert(grid && !grid->mPoints.empty());
-
-            float distanceBetween = distanceSquared(grid->mPoints[0], pos);
-            int closestIndex = 0;
-
-            // TODO: if this full scan causes performance problems mapping pathgrid
-            //       points to a quadtree may help
-            for (unsigned int counter = 1; counter < grid->mPoints.size(); counter++)
-            {
-                float potentialDistBetween = distanceSquared(grid->mPoints[counter], pos);
-                if (potentialDistBetween < distanceBetween)
-                {
-                    distanceBetween = potentialDistBetween;
-                    closestIndex = counter;
-                }
-            }
-
-            return closestIndex;
-        }
-
     private:
         bool mConstructed = false;
         std::deque<osg::Vec3f> mPath;
         const MWWorld::CellStore* mCell = nullptr;
+        std::shared_future<DetourNavigator::PathQueryResult> mPendingPath;
+        osg::Vec3f mPendingStart;
+        osg::Vec3f mPendingEnd;
 
         void buildPathByPathgridImpl(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
             const PathgridGraph& pathgridGraph, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
@@ -212,6 +199,13 @@ namespace MWMechanics
             const osg::Vec3f& startPoint, const osg::Vec3f& endPoint, const DetourNavigator::AgentBounds& agentBounds,
             const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts, float endTolerance,
             PathType pathType, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
+
+        // Continues buildPath after the navmesh path with given flags is not found
+        void buildFallbackPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
+            const osg::Vec3f& endPoint, const PathgridGraph& pathgridGraph,
+            const DetourNavigator::AgentBounds& agentBounds, const DetourNavigator::Flags flags,
+            const DetourNavigator::AreaCosts& areaCosts, float endTolerance, PathType pathType,
+            DetourNavigator::Status status);
     };
 }
 
@@ -1,7 +1,10 @@
 #include "pathgrid.hpp"
 
-#include <list>
-#include <set>
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <tuple>
 
 namespace
 {
@@ -44,6 +47,43 @@ namespace
     }
 
     constexpr size_t NoIndex = static_cast<size_t>(-1);
+
+    // Limits memory used by cached paths, the whole cache is dropped when the limit is reached
+    constexpr size_t maxCachedPaths = 4096;
+
+    osg::Vec3f toVec3f(const ESM::Pathgrid::Point& point)
+    {
+        return osg::Vec3f(static_cast<float>(point.mX), static_cast<float>(point.mY), static_cast<float>(point.mZ));
+    }
+
+    // Distance along x axis is a lower bound for the full distance so points ordered by x can be checked starting
+    // from the closest by x in both directions until it gets greater than the best distance found. Calls function
+    // with point index and squared distance, function returns current maximum squared distance to check.
+    template <class Function>
+    void forEachCloserPoint(const ESM::Pathgrid& pathgrid, const std::vector<size_t>& pointsByX,
+        const osg::Vec3f& pos, Function&& function)
+    {
+        const auto lessX = [&](size_t index, float x) { return static_cast<float>(pathgrid.mPoints[index].mX) < x; };
+        const auto middle = std::lower_bound(pointsByX.begin(), pointsByX.end(), pos.x(), lessX);
+        float maxDistance = std::numeric_limits<float>::max();
+        const auto check = [&](size_t index) {
+            const float dx = static_cast<float>(pathgrid.mPoints[index].mX) - pos.x();
+            if (dx * dx > maxDistance)
+                return false;
+            maxDistance = function(index, (toVec3f(pathgrid.mPoints[index]) - pos).length2());
+            return true;
+        };
+        for (auto it = middle; it != pointsByX.end() && check(*it); ++it)
+            ;
+        for (auto it = std::make_reverse_iterator(middle); it != pointsByX.rend() && check(*it); ++it)
+            ;
+    }
+
+    // Equally distant points are ordered by index to keep the result same as of a full scan
+    bool isCloser(float distance, size_t index, float bestDistance, size_t bestIndex)
+    {
+        return distance < bestDistance || (distance == bestDistance && index < bestIndex);
+    }
 }
 
 namespace MWMechanics
@@ -187,6 +227,13 @@ namespace MWMechanics
             // mGraph[edge.mV1].edges.push_back(neighbour);
         }
         Builder(*this);
+
+        mPointsByX.resize(mPathgrid->mPoints.size());
+        for (size_t i = 0; i < mPointsByX.size(); ++i)
+            mPointsByX[i] = i;
+        std::sort(mPointsByX.begin(), mPointsByX.end(), [&](size_t l, size_t r) {
+            return std::make_pair(mPathgrid->mPoints[l].mX, l) < std::make_pair(mPathgrid->mPoints[r].mX, r);
+        });
     }
 
     const PathgridGraph PathgridGraph::sEmpty = {};
@@ -232,82 +279,150 @@ namespace MWMechanics
      *       pathgrid points form (currently they are converted to world
      *       coordinates).  Essentially trading speed w/ memory.
      */
-    std::deque<ESM::Pathgrid::Point> PathgridGraph::aStarSearch(const size_t start, const size_t goal) const
+    size_t PathgridGraph::getClosestPoint(const osg::Vec3f& pos) const
+    {
+        assert(mPathgrid && !mPathgrid->mPoints.empty());
+
+        float closestDistance = std::numeric_limits<float>::max();
+        size_t closestIndex = NoIndex;
+        forEachCloserPoint(*mPathgrid, mPointsByX, pos, [&](size_t index, float distance) {
+            if (isCloser(distance, index, closestDistance, closestIndex))
+            {
+                closestDistance = distance;
+                closestIndex = index;
+            }
+            return closestDistance;
+        });
+        return closestIndex;
+    }
+
+    std::pair<size_t, bool> PathgridGraph::getClosestReachablePoint(const osg::Vec3f& pos, const size_t start) const
+    {
+        assert(mPathgrid && !mPathgrid->mPoints.empty());
+
+        float closestDistance = std::numeric_limits<float>::max();
+        float closestReachableDistance = std::numeric_limits<float>::max();
+        size_t closestIndex = NoIndex;
+        size_t closestReachableIndex = NoIndex;
+        // The closest point is not further than the closest reachable one so both are found checking points until
+        // the closest reachable distance
+        forEachCloserPoint(*mPathgrid, mPointsByX, pos, [&](size_t index, float distance) {
+            if (isCloser(distance, index, closestDistance, closestIndex))
+            {
+                closestDistance = distance;
+                closestIndex = index;
+            }
+            if (isCloser(distance, index, closestReachableDistance, closestReachableIndex)
+                && isPointConnected(start, index))
+            {
+                closestReachableDistance = distance;
+                closestReachableIndex = index;
+            }
+            return closestReachableDistance;
+        });
+
+        // post-condition: start and endpoint must be connected
+        assert(closestReachableIndex != NoIndex && isPointConnected(start, closestReachableIndex));
+
+        return { closestReachableIndex, closestReachableIndex == closestIndex };
+    }
+
+    std::vector<size_t> PathgridGraph::findPath(const size_t start, const size_t goal) const
     {
-        std::deque<ESM::Pathgrid::Point> path;
         if (!isPointConnected(start, goal))
+            return {};
+
+        const auto key = std::make_pair(start, goal);
+        auto it = mPaths.find(key);
+        if (it == mPaths.end())
         {
-            return path; // there is no path, return an empty path
+            if (mPaths.size() >= maxCachedPaths)
+                mPaths.clear();
+            it = mPaths.emplace(key, std::vector<size_t>()).first;
+            searchPath(start, goal, it->second);
         }
+        return it->second;
+    }
 
-        size_t graphSize = mGraph.size();
-        std::vector<float> gScore(graphSize, -1);
-        std::vector<float> fScore(graphSize, -1);
-        std::vector<size_t> graphParent(graphSize, NoIndex);
+    /*
+     * NOTE: Based on buildPath2(), please check git history if interested
+     *       Should consider using a 3rd party library version (e.g. boost)
+     *
+     * Find the shortest path to the target goal using a well known algorithm.
+     * Uses mGraph which has pre-computed costs for allowed edges.  It is assumed
+     * that mGraph is already constructed.
+     *
+     * Not MT safe, search state is reused between calls to avoid allocations.
+     *
+     * Writes path which may be empty.  path contains pathgrid point indexes.
+     *
+     * Input params:
+     *   start, goal - pathgrid point indexes (for this cell)
+     *
+     * Variables:
+     *   mOpenSet - binary heap of point indexes to be traversed, lowest cost first,
+     *              points added earlier go first for equal cost. A point may be
+     *              added again with lower cost, the outdated entry is skipped.
+     *   mClosed - point indexes already traversed
+     *   mGScore - past accumulated costs vector indexed by point index
+     */
+    void PathgridGraph::searchPath(const size_t start, const size_t goal, std::vector<size_t>& path) const
+    {
+        const size_t graphSize = mGraph.size();
+        mGScore.assign(graphSize, -1);
+        mParent.assign(graphSize, NoIndex);
+        mClosed.assign(graphSize, false);
+        mOpenSet.clear();
 
-        // gScore & fScore keep costs for each pathgrid point in mPoints
-        gScore[start] = 0;
-        fScore[start] = costAStar(mPathgrid->mPoints[start], mPathgrid->mPoints[goal]);
+        const auto greater = [](const OpenNode& l, const OpenNode& r) {
+            return std::tie(l.mCost, l.mOrder) > std::tie(r.mCost, r.mOrder);
+        };
+        size_t order = 0;
 
-        std::list<size_t> openset;
-        std::set<size_t> closedset;
-        openset.push_back(start);
+        mGScore[start] = 0;
+        mOpenSet.push_back(
+            OpenNode{ costAStar(mPathgrid->mPoints[start], mPathgrid->mPoints[goal]), order++, start });
 
         size_t current = start;
 
-        while (!openset.empty())
+        while (!mOpenSet.empty())
         {
-            current = openset.front(); // front has the lowest cost
-            openset.pop_front();
+            std::pop_heap(mOpenSet.begin(), mOpenSet.end(), greater);
+            current = mOpenSet.back().mIndex;
+            mOpenSet.pop_back();
+
+            if (mClosed[current])
+                continue; // outdated entry
 
             if (current == goal)
                 break;
 
-            closedset.insert(current); // remember we've been here
+            mClosed[current] = true; // remember we've been here
 
             // check all edges for the current point index
             for (const auto& edge : mGraph[current].edges)
             {
-                if (!closedset.contains(edge.index))
+                const size_t dest = edge.index;
+                if (mClosed[dest])
+                    continue; // traversed this edge destination already, try the next edge
+                const float tentativeG = mGScore[current] + edge.cost;
+                if (mGScore[dest] < 0 || tentativeG < mGScore[dest])
                 {
-                    // not in closedset - i.e. have not traversed this edge destination
-                    size_t dest = edge.index;
-                    float tentative_g = gScore[current] + edge.cost;
-                    bool isInOpenSet = std::find(openset.begin(), openset.end(), dest) != openset.end();
-                    if (!isInOpenSet || tentative_g < gScore[dest])
-                    {
-                        graphParent[dest] = current;
-                        gScore[dest] = tentative_g;
-                        fScore[dest] = tentative_g + costAStar(mPathgrid->mPoints[dest], mPathgrid->mPoints[goal]);
-                        if (!isInOpenSet)
-                        {
-                            // add this edge to openset, lowest cost goes to the front
-                            // TODO: if this causes performance problems a hash table may help
-                            auto it = openset.begin();
-                            for (; it != openset.end(); ++it)
-                            {
-                                if (fScore[*it] > fScore[dest])
-                                    break;
-                            }
-                            openset.insert(it, dest);
-                        }
-                    }
-                } // if in closedset, i.e. traversed this edge already, try the next edge
+                    mParent[dest] = current;
+                    mGScore[dest] = tentativeG;
+                    const float fScore = tentativeG + costAStar(mPathgrid->mPoints[dest], mPathgrid->mPoints[goal]);
+                    mOpenSet.push_back(OpenNode{ fScore, order++, dest });
+                    std::push_heap(mOpenSet.begin(), mOpenSet.end(), greater);
+                }
             }
         }
 
         if (current != goal)
-            return path; // for some reason couldn't build a path
-
-        // reconstruct path to return, using local coordinates
-        while (graphParent[current] != NoIndex)
-        {
-            path.push_front(mPathgrid->mPoints[current]);
-            current = graphParent[current];
-        }
+            return; // for some reason couldn't build a path
 
-        // add first node to path explicitly
-        path.push_front(mPathgrid->mPoints[start]);
-        return path;
+        // reconstruct path to return
+        for (; current != NoIndex; current = mParent[current])
+            path.push_back(current);
+        std::reverse(path.begin(), path.end());
     }
 }
@@ -1,7 +1,12 @@
 #ifndef GAME_MWMECHANICS_PATHGRID_H
 #define GAME_MWMECHANICS_PATHGRID_H
 
-#include <deque>
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <osg/Vec3f>
 
 #include <components/esm3/loadpgrd.hpp>
 
@@ -26,12 +31,20 @@ namespace MWMechanics
         // get neighbouring nodes for index node and put them to "nodes" vector
         void getNeighbouringPoints(const size_t index, ESM::Pathgrid::PointList& nodes) const;
 
-        // the input parameters are pathgrid point indexes
-        // the output list is in local (internal cells) or world (external
-        // cells) coordinates
-        //
-        // NOTE: if start equals end an empty path is returned
-        std::deque<ESM::Pathgrid::Point> aStarSearch(const size_t start, const size_t end) const;
+        // returns the closest pathgrid point index to pos in local coordinates,
+        // the lowest index is returned for equally close points.
+        // NOTE: Does not check if there is a sensible way to get there
+        // (e.g. a cliff in front).
+        size_t getClosestPoint(const osg::Vec3f& pos) const;
+
+        // returns the closest pathgrid point index to pos in local coordinates
+        // connected to start and whether it is also the closest point at all
+        std::pair<size_t, bool> getClosestReachablePoint(const osg::Vec3f& pos, const size_t start) const;
+
+        // returns pathgrid point indexes of the path from start to end including both
+        // (a single point if start equals end), empty if there is no path. Found paths
+        // are cached, the result is a copy and does not depend on the cache.
+        std::vector<size_t> findPath(const size_t start, const size_t end) const;
 
         static const PathgridGraph sEmpty;
 
@@ -62,6 +75,27 @@ namespace MWMechanics
         //   all other pathgrid points are the third set
         //
         std::vector<Node> mGraph;
+
+        // point indexes ordered by x coordinate for closest point lookups
+        std::vector<size_t> mPointsByX;
+
+        // paths found by findPath, pathgrids can never change during runtime
+        mutable std::map<std::pair<size_t, size_t>, std::vector<size_t>> mPaths;
+
+        // A* state reused between searches
+        struct OpenNode
+        {
+            float mCost;
+            size_t mOrder;
+            size_t mIndex;
+        };
+
+        mutable std::vector<float> mGScore;
+        mutable std::vector<size_t> mParent;
+        mutable std::vector<bool> mClosed;
+        mutable std::vector<OpenNode> mOpenSet;
+
+        void searchPath(const size_t start, const size_t goal, std::vector<size_t>& path) const;
     };
 }
 
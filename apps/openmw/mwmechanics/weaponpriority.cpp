@@ -147,7 +147,8 @@ namespace MWMechanics
 
         MWWorld::InventoryStore& store = actor.getClass().getInventoryStore(actor);
 
-        for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+        for (MWWorld::ContainerStoreIterator it = store.begin(MWWorld::ContainerStore::Type_Weapon); it != store.end();
+             ++it)
         {
             float rating = rateWeapon(*it, actor, enemy, ammoType);
             if (rating > bestAmmoRating)
@@ -0,0 +1,90 @@
+#include "collisioncandidates.hpp"
+
+#include <BulletCollision/BroadphaseCollision/btBroadphaseInterface.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionShapes/btConvexShape.h>
+#include <LinearMath/btAabbUtil2.h>
+
+namespace MWPhysics
+{
+    namespace
+    {
+        class GatherCallback final : public btBroadphaseAabbCallback
+        {
+        public:
+            GatherCallback(const btCollisionObject* actor, std::vector<CollisionCandidates::Candidate>& candidates)
+                : mActor(actor)
+                , mCandidates(candidates)
+            {
+            }
+
+            bool process(const btBroadphaseProxy* proxy) override
+            {
+                const auto collisionObject = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+                if (collisionObject != mActor)
+                    mCandidates.push_back({ collisionObject, proxy->m_aabbMin, proxy->m_aabbMax });
+                return true;
+            }
+
+        private:
+            const btCollisionObject* mActor;
+            std::vector<CollisionCandidates::Candidate>& mCandidates;
+        };
+    }
+
+    void CollisionCandidates::gather(const btCollisionObject* actor, const btVector3& aabbMin,
+        const btVector3& aabbMax, const btCollisionWorld* world)
+    {
+        mCandidates.clear();
+        mAabbMin = aabbMin;
+        mAabbMax = aabbMax;
+        GatherCallback callback(actor, mCandidates);
+        // btBroadphaseInterface::aabbTest is not const but doesn't modify the broadphase
+        const_cast<btBroadphaseInterface*>(world->getBroadphase())->aabbTest(aabbMin, aabbMax, callback);
+        mGathered = true;
+    }
+
+    void CollisionCandidates::clear()
+    {
+        mCandidates.clear();
+        mGathered = false;
+    }
+
+    bool CollisionCandidates::covers(const btVector3& aabbMin, const btVector3& aabbMax) const
+    {
+        if (!mGathered)
+            return false;
+        return mAabbMin.x() <= aabbMin.x() && mAabbMin.y() <= aabbMin.y() && mAabbMin.z() <= aabbMin.z()
+            && aabbMax.x() <= mAabbMax.x() && aabbMax.y() <= mAabbMax.y() && aabbMax.z() <= mAabbMax.z();
+    }
+
+    bool CollisionCandidates::convexSweepTest(const btConvexShape* shape, const btTransform& from,
+        const btTransform& to, btCollisionWorld::ConvexResultCallback& callback, btScalar allowedPenetration) const
+    {
+        // Actor sweeps never rotate the shape, so the swept volume is bounded by the union of both end boxes
+        btVector3 sweepMin;
+        btVector3 sweepMax;
+        shape->getAabb(from, sweepMin, sweepMax);
+        btVector3 toMin;
+        btVector3 toMax;
+        shape->getAabb(to, toMin, toMax);
+        sweepMin.setMin(toMin);
+        sweepMax.setMax(toMax);
+
+        if (!covers(sweepMin, sweepMax))
+            return false;
+
+        for (const Candidate& candidate : mCandidates)
+        {
+            if (!TestAabbAgainstAabb2(sweepMin, sweepMax, candidate.mAabbMin, candidate.mAabbMax))
+                continue;
+            if (!callback.needsCollision(candidate.mObject->getBroadphaseHandle()))
+                continue;
+            btCollisionWorld::objectQuerySingle(shape, from, to, const_cast<btCollisionObject*>(candidate.mObject),
+                candidate.mObject->getCollisionShape(), candidate.mObject->getWorldTransform(), callback,
+                allowedPenetration);
+        }
+
+        return true;
+    }
+}
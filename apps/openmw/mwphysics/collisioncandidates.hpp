@@ -0,0 +1,49 @@
+#ifndef OPENMW_MWPHYSICS_COLLISIONCANDIDATES_H
+#define OPENMW_MWPHYSICS_COLLISIONCANDIDATES_H
+
+#include <BulletCollision/CollisionDispatch/btCollisionWorld.h>
+#include <LinearMath/btVector3.h>
+
+#include <vector>
+
+class btCollisionObject;
+class btConvexShape;
+
+namespace MWPhysics
+{
+    /// Collision objects which may be touched by an actor during a single simulation step.
+    /// The broadphase is queried once for the whole region the actor can reach, then each sweep done by the movement
+    /// solver (including step up and slide corrections) runs the narrowphase against this local set only.
+    class CollisionCandidates
+    {
+    public:
+        struct Candidate
+        {
+            const btCollisionObject* mObject;
+            btVector3 mAabbMin;
+            btVector3 mAabbMax;
+        };
+
+        void gather(const btCollisionObject* actor, const btVector3& aabbMin, const btVector3& aabbMax,
+            const btCollisionWorld* world);
+
+        void clear();
+
+        /// Same as btCollisionWorld::convexSweepTest but limited to the gathered objects. Returns false without
+        /// testing anything when the swept volume leaves the gathered region, the caller has to query the world then.
+        bool convexSweepTest(const btConvexShape* shape, const btTransform& from, const btTransform& to,
+            btCollisionWorld::ConvexResultCallback& callback, btScalar allowedPenetration) const;
+
+        std::size_t size() const { return mCandidates.size(); }
+
+    private:
+        std::vector<Candidate> mCandidates;
+        btVector3 mAabbMin{ 0, 0, 0 };
+        btVector3 mAabbMax{ 0, 0, 0 };
+        bool mGathered = false;
+
+        bool covers(const btVector3& aabbMin, const btVector3& aabbMax) const;
+    };
+}
+
+#endif
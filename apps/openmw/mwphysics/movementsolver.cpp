@@ -12,6 +12,7 @@
 #include "../mwworld/esmstore.hpp"
 
 #include "actor.hpp"
+#include "collisioncandidates.hpp"
 #include "collisiontype.hpp"
 #include "constants.hpp"
 #include "contacttestwrapper.h"
@@ -21,6 +22,7 @@
 #include "stepper.hpp"
 #include "trace.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace MWPhysics
@@ -79,6 +81,23 @@ namespace MWPhysics
         const btCollisionObject* mMe;
     };
 
+    // Gather everything the actor could touch while moving with the given velocity. Sliding never speeds the actor up,
+    // so the reach is bounded by the movement distance plus the stair stepping and ground snapping distances. Traces
+    // leaving the gathered region fall back to querying the whole collision world.
+    static void gatherCandidates(const ActorFrameData& actor, const osg::Vec3f& velocity, float time,
+        const btCollisionWorld* collisionWorld, CollisionCandidates& candidates)
+    {
+        const float reach = velocity.length() * time + std::max(sMinStep, sMinStep2) + Constants::sStepSizeUp
+            + sStepSizeDown + 2 * sGroundOffset + 4 * sCollisionMargin;
+        const btTransform transform(
+            actor.mCollisionObject->getWorldTransform().getBasis(), Misc::Convert::toBullet(actor.mPosition));
+        btVector3 aabbMin;
+        btVector3 aabbMax;
+        actor.mCollisionObject->getCollisionShape()->getAabb(transform, aabbMin, aabbMax);
+        const btVector3 extent(reach, reach, reach);
+        candidates.gather(actor.mCollisionObject, aabbMin - extent, aabbMax + extent, collisionWorld);
+    }
+
     osg::Vec3f MovementSolver::traceDown(const MWWorld::Ptr& ptr, const osg::Vec3f& position, Actor* actor,
         btCollisionWorld* collisionWorld, float maxHeight)
     {
@@ -183,7 +202,14 @@ namespace MWPhysics
             velocity *= 1.f - (fStromWalkMult * (angleDegrees / 180.f));
         }
 
-        Stepper stepper(collisionWorld, actor.mCollisionObject);
+        // Reused across calls to avoid allocations, move is called from several physics threads
+        static thread_local CollisionCandidates candidates;
+        if (velocity.length2() > 0)
+            gatherCandidates(actor, velocity, time, collisionWorld, candidates);
+        else
+            candidates.clear();
+
+        Stepper stepper(collisionWorld, actor.mCollisionObject, &candidates);
         osg::Vec3f origVelocity = velocity;
         osg::Vec3f newPosition = actor.mPosition;
         /*
@@ -215,7 +241,8 @@ namespace MWPhysics
             if ((newPosition - nextpos).length2() > 0.0001)
             {
                 // trace to where character would go if there were no obstructions
-                tracer.doTrace(actor.mCollisionObject, newPosition, nextpos, collisionWorld, actor.mIsOnGround);
+                tracer.doTrace(
+                    actor.mCollisionObject, newPosition, nextpos, collisionWorld, actor.mIsOnGround, &candidates);
 
                 // check for obstructions
                 if (tracer.mFraction >= 1.0f)
@@ -317,7 +344,8 @@ namespace MWPhysics
                             auto averageNormal = bestNormal + origPlaneNormal;
                             averageNormal.normalize();
                             tracer.doTrace(actor.mCollisionObject, newPosition,
-                                newPosition + averageNormal * (sCollisionMargin * 2.0), collisionWorld);
+                                newPosition + averageNormal * (sCollisionMargin * 2.0), collisionWorld, false,
+                                &candidates);
                             newPosition = (newPosition + tracer.mEndPos) / 2.0;
 
                             usedSeamLogic = true;
@@ -333,7 +361,7 @@ namespace MWPhysics
                 if (!usedSeamLogic)
                 {
                     tracer.doTrace(actor.mCollisionObject, newPosition,
-                        newPosition + planeNormal * (sCollisionMargin * 2.0), collisionWorld);
+                        newPosition + planeNormal * (sCollisionMargin * 2.0), collisionWorld, false, &candidates);
                     newPosition = (newPosition + tracer.mEndPos) / 2.0;
                 }
 
@@ -372,7 +400,7 @@ namespace MWPhysics
             osg::Vec3f from = newPosition;
             auto dropDistance = 2 * sGroundOffset + (actor.mIsOnGround ? sStepSizeDown : 0);
             osg::Vec3f to = newPosition - osg::Vec3f(0, 0, dropDistance);
-            tracer.doTrace(actor.mCollisionObject, from, to, collisionWorld, actor.mIsOnGround);
+            tracer.doTrace(actor.mCollisionObject, from, to, collisionWorld, actor.mIsOnGround, &candidates);
             if (tracer.mFraction < 1.0f)
             {
                 if (!isActor(tracer.mHitObject))
@@ -391,7 +419,7 @@ namespace MWPhysics
                         {
                             newPosition.z() = tracer.mEndPos.z();
                             tracer.doTrace(actor.mCollisionObject, newPosition,
-                                newPosition + osg::Vec3f(0, 0, 2 * sGroundOffset), collisionWorld);
+                                newPosition + osg::Vec3f(0, 0, 2 * sGroundOffset), collisionWorld, false, &candidates);
                             newPosition = (newPosition + tracer.mEndPos) / 2.0;
                         }
                     }
@@ -13,16 +13,20 @@ namespace osg
 
 namespace MWPhysics
 {
+    class CollisionCandidates;
+
     class Stepper
     {
     private:
         const btCollisionWorld* mColWorld;
         const btCollisionObject* mColObj;
+        const CollisionCandidates* mCandidates;
 
         ActorTracer mTracer, mUpStepper, mDownStepper;
 
     public:
-        Stepper(const btCollisionWorld* colWorld, const btCollisionObject* colObj);
+        Stepper(const btCollisionWorld* colWorld, const btCollisionObject* colObj,
+            const CollisionCandidates* candidates = nullptr);
 
         bool step(osg::Vec3f& position, osg::Vec3f& velocity, float& remainingTime, const bool& onGround,
             bool firstIteration);
@@ -7,13 +7,14 @@
 
 #include "actor.hpp"
 #include "actorconvexcallback.hpp"
+#include "collisioncandidates.hpp"
 #include "collisiontype.hpp"
 
 namespace MWPhysics
 {
 
     ActorConvexCallback sweepHelper(const btCollisionObject* actor, const btVector3& from, const btVector3& to,
-        const btCollisionWorld* world, bool actorFilter)
+        const btCollisionWorld* world, bool actorFilter, const CollisionCandidates* candidates)
     {
         const btTransform& trans = actor->getWorldTransform();
         btTransform transFrom(trans);
@@ -33,12 +34,16 @@ namespace MWPhysics
         if (actorFilter)
             traceCallback.m_collisionFilterMask &= ~CollisionType_Actor;
 
-        world->convexSweepTest(static_cast<const btConvexShape*>(shape), transFrom, transTo, traceCallback);
+        const auto convexShape = static_cast<const btConvexShape*>(shape);
+        if (candidates == nullptr
+            || !candidates->convexSweepTest(convexShape, transFrom, transTo, traceCallback,
+                world->getDispatchInfo().m_allowedCcdPenetration))
+            world->convexSweepTest(convexShape, transFrom, transTo, traceCallback);
         return traceCallback;
     }
 
     void ActorTracer::doTrace(const btCollisionObject* actor, const osg::Vec3f& start, const osg::Vec3f& end,
-        const btCollisionWorld* world, bool attempt_short_trace)
+        const btCollisionWorld* world, bool attempt_short_trace, const CollisionCandidates* candidates)
     {
         const btVector3 btstart = Misc::Convert::toBullet(start);
         btVector3 btend = Misc::Convert::toBullet(end);
@@ -62,7 +67,7 @@ namespace MWPhysics
             doing_short_trace = true;
         }
 
-        const auto traceCallback = sweepHelper(actor, btstart, btend, world, false);
+        const auto traceCallback = sweepHelper(actor, btstart, btend, world, false, candidates);
 
         // Copy the hit data over to our trace results struct:
         if (traceCallback.hasHit())
@@ -81,7 +86,7 @@ namespace MWPhysics
             if (doing_short_trace)
             {
                 btend = Misc::Convert::toBullet(end);
-                const auto newTraceCallback = sweepHelper(actor, btstart, btend, world, false);
+                const auto newTraceCallback = sweepHelper(actor, btstart, btend, world, false, candidates);
 
                 if (newTraceCallback.hasHit())
                 {
@@ -105,8 +110,8 @@ namespace MWPhysics
     void ActorTracer::findGround(
         const Actor* actor, const osg::Vec3f& start, const osg::Vec3f& end, const btCollisionWorld* world)
     {
-        const auto traceCallback = sweepHelper(
-            actor->getCollisionObject(), Misc::Convert::toBullet(start), Misc::Convert::toBullet(end), world, true);
+        const auto traceCallback = sweepHelper(actor->getCollisionObject(), Misc::Convert::toBullet(start),
+            Misc::Convert::toBullet(end), world, true, nullptr);
         if (traceCallback.hasHit())
         {
             mFraction = traceCallback.m_closestHitFraction;
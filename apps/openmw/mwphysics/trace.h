@@ -9,6 +9,7 @@ class btCollisionWorld;
 namespace MWPhysics
 {
     class Actor;
+    class CollisionCandidates;
 
     struct ActorTracer
     {
@@ -20,7 +21,8 @@ namespace MWPhysics
         float mFraction;
 
         void doTrace(const btCollisionObject* actor, const osg::Vec3f& start, const osg::Vec3f& end,
-            const btCollisionWorld* world, bool attempt_short_trace = false);
+            const btCollisionWorld* world, bool attempt_short_trace = false,
+            const CollisionCandidates* candidates = nullptr);
         void findGround(
             const Actor* actor, const osg::Vec3f& start, const osg::Vec3f& end, const btCollisionWorld* world);
     };
@@ -730,13 +730,8 @@ namespace MWRender
     {
         for (AnimSourceList::const_reverse_iterator iter(mAnimSources.rbegin()); iter != mAnimSources.rend(); ++iter)
         {
-            const SceneUtil::TextKeyMap& keys = (*iter)->getTextKeys();
-
-            for (auto iterKey = keys.begin(); iterKey != keys.end(); ++iterKey)
-            {
-                if (iterKey->second.starts_with(textKey))
-                    return iterKey->first;
-            }
+            if (const std::optional<float> time = (*iter)->getTextKeys().findFirstTime(textKey))
+                return *time;
         }
 
         return -1.f;
@@ -644,8 +644,13 @@ void MWWorld::ContainerStore::addInitialItemImp(
 
         if (topLevel && std::abs(count) > 1 && levItemList->mFlags & ESM::ItemLevList::Each)
         {
+            const int level = MWMechanics::getLevelledListLevel();
             for (int i = 0; i < std::abs(count); ++i)
-                addInitialItem(ptr.getCellRef().getRefId(), owner, count > 0 ? 1 : -1, prng, true);
+            {
+                const ESM::RefId itemId = MWMechanics::getLevelledItem(levItemList, false, *prng, level);
+                if (!itemId.empty())
+                    addInitialItem(itemId, owner, count > 0 ? 1 : -1, prng, false);
+            }
             return;
         }
         else
@@ -139,7 +139,7 @@ MWWorld::ContainerStoreIterator MWWorld::InventoryStore::add(
     {
         auto type = itemPtr.getType();
         if (type == ESM::Armor::sRecordId || type == ESM::Clothing::sRecordId)
-            autoEquip();
+            autoEquipArmorSlots();
     }
 
     if (mListener)
@@ -527,24 +527,38 @@ void MWWorld::InventoryStore::autoEquip()
     autoEquipWeapon(slots_);
     autoEquipArmor(slots_);
 
-    bool changed = false;
+    mUpdatesEnabled = true;
+
+    applyAutoEquipSlots(slots_);
+}
+
+void MWWorld::InventoryStore::autoEquipArmorSlots()
+{
+    TSlots slots_;
+    initSlots(slots_);
+
+    // The weapon choice does not depend on armor and clothing, so there is no need to rate all weapons again
+    slots_[Slot_CarriedRight] = mSlots[Slot_CarriedRight];
+    slots_[Slot_Ammunition] = mSlots[Slot_Ammunition];
+
+    // Disable model update during auto-equip
+    mUpdatesEnabled = false;
+
+    autoEquipArmor(slots_);
 
-    for (std::size_t i = 0; i < slots_.size(); ++i)
-    {
-        if (slots_[i] != mSlots[i])
-        {
-            changed = true;
-            break;
-        }
-    }
     mUpdatesEnabled = true;
 
-    if (changed)
-    {
-        mSlots.swap(slots_);
-        fireEquipmentChangedEvent();
-        flagAsModified();
-    }
+    applyAutoEquipSlots(slots_);
+}
+
+void MWWorld::InventoryStore::applyAutoEquipSlots(TSlots& slots_)
+{
+    if (slots_ == mSlots)
+        return;
+
+    mSlots.swap(slots_);
+    fireEquipmentChangedEvent();
+    flagAsModified();
 }
 
 MWWorld::ContainerStoreIterator MWWorld::InventoryStore::getPreferredShield()
@@ -615,7 +629,7 @@ int MWWorld::InventoryStore::remove(const Ptr& item, int count, bool equipReplac
     {
         auto type = item.getType();
         if (type == ESM::Armor::sRecordId || type == ESM::Clothing::sRecordId)
-            autoEquip();
+            autoEquipArmorSlots();
     }
 
     if (item.getRefData().getCount() == 0 && mSelectedEnchantItem != end() && *mSelectedEnchantItem == item)
@@ -71,6 +71,11 @@ namespace MWWorld
         void autoEquipArmor(TSlots& slots_);
         void autoEquipShield(TSlots& slots_);
 
+        void autoEquipArmorSlots();
+        ///< Re-evaluate armor and clothing slots only, keeping the equipped weapon and ammunition.
+
+        void applyAutoEquipSlots(TSlots& slots_);
+
         // selected magic item (for using enchantments of type "Cast once" or "Cast when used")
         ContainerStoreIterator mSelectedEnchantItem;
 
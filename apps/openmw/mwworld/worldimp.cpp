@@ -46,6 +46,7 @@
 #include <components/detournavigator/agentbounds.hpp>
 #include <components/detournavigator/debug.hpp>
 #include <components/detournavigator/navigator.hpp>
+#include <components/detournavigator/pathqueryservice.hpp>
 #include <components/detournavigator/settings.hpp>
 #include <components/detournavigator/stats.hpp>
 #include <components/detournavigator/updateguard.hpp>
@@ -299,6 +300,8 @@ namespace MWWorld
             auto navigatorSettings = DetourNavigator::makeSettingsFromSettingsManager();
             navigatorSettings.mRecast.mSwimHeightScale = mSwimHeightScale;
             mNavigator = DetourNavigator::makeNavigator(navigatorSettings, mUserDataPath);
+            if (const std::size_t threads = Settings::navigator().mPathQueryThreads; threads > 0)
+                mPathQueryService = std::make_unique<DetourNavigator::PathQueryService>(*mNavigator, threads);
         }
         else
         {
@@ -1225,6 +1228,8 @@ namespace MWWorld
             mWorldScene->removeFromPagedRefs(newPtr);
         }
 
+        MWBase::Environment::get().getLuaManager()->objectMoved(newPtr);
+
         return newPtr;
     }
 
@@ -3775,6 +3780,11 @@ namespace MWWorld
         return mNavigator.get();
     }
 
+    DetourNavigator::PathQueryService* World::getPathQueryService() const
+    {
+        return mPathQueryService.get();
+    }
+
     void World::updateActorPath(const MWWorld::ConstPtr& actor, const std::deque<osg::Vec3f>& path,
         const DetourNavigator::AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end) const
     {
@@ -127,6 +127,21 @@ namespace
         }
     }
 
+    TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, post_should_report_job_latency)
+    {
+        mRecastMeshManager.setWorldspace(mWorldspace, nullptr);
+        addHeightFieldPlane(mRecastMeshManager);
+        AsyncNavMeshUpdater updater(mSettings, mRecastMeshManager, mOffMeshConnectionsManager, nullptr);
+        const auto navMeshCacheItem = std::make_shared<GuardedNavMeshCacheItem>(1, mSettings);
+        const std::map<TilePosition, ChangeType> changedTiles{ { TilePosition{ 0, 0 }, ChangeType::add } };
+        updater.post(mAgentBounds, navMeshCacheItem, mPlayerTile, mWorldspace, changedTiles);
+        updater.wait(WaitConditionType::allJobsDone, &mListener);
+        const auto stats = updater.getStats();
+        EXPECT_EQ(stats.mLatency.mRegular.getCount(), 1);
+        EXPECT_EQ(stats.mLatency.mRequired.getCount(), 0);
+        EXPECT_TRUE(stats.mLatency.mRegular.getQuantileUpperBound(0.9).has_value());
+    }
+
     TEST_F(DetourNavigatorAsyncNavMeshUpdaterTest, post_should_write_generated_tile_to_db)
     {
         mRecastMeshManager.setWorldspace(mWorldspace, nullptr);
@@ -299,4 +314,43 @@ namespace
                     << " present=" << (present.find(tilePosition) != present.end());
             }
     }
+
+    struct DetourNavigatorJobPriorityTest : Test
+    {
+        const AgentBounds mAgentBounds{ CollisionShapeType::Aabb, { 29, 29, 66 } };
+
+        Job makeJob(const TilePosition& tile, int distanceToPlayer, const TileCost& cost = TileCost{}) const
+        {
+            return Job(mAgentBounds, {}, "sys::default", tile, ChangeType::add, distanceToPlayer,
+                std::chrono::steady_clock::time_point(), cost);
+        }
+    };
+
+    TEST_F(DetourNavigatorJobPriorityTest, closer_to_player_tile_should_be_processed_first)
+    {
+        const Job close = makeJob(TilePosition(0, 0), 0);
+        const Job far = makeJob(TilePosition(5, 5), 10);
+        EXPECT_TRUE(hasHigherPriority(close, far));
+        EXPECT_FALSE(hasHigherPriority(far, close));
+    }
+
+    TEST_F(DetourNavigatorJobPriorityTest, required_tile_should_be_processed_before_closer_one)
+    {
+        const Job close = makeJob(TilePosition(0, 0), 0);
+        Job required = makeJob(TilePosition(5, 5), 10);
+        required.mRequired = true;
+        EXPECT_TRUE(hasHigherPriority(required, close));
+        EXPECT_FALSE(hasHigherPriority(close, required));
+    }
+
+    TEST_F(DetourNavigatorJobPriorityTest, for_same_distance_cheaper_tile_should_be_processed_first)
+    {
+        const Job cheap = makeJob(TilePosition(1, 0), 1, TileCost{ .mTriangles = 100 });
+        const Job costly = makeJob(TilePosition(0, 1), 1, TileCost{ .mTriangles = 10000 });
+        EXPECT_TRUE(hasHigherPriority(cheap, costly));
+        EXPECT_FALSE(hasHigherPriority(costly, cheap));
+
+        const Job slow = makeJob(TilePosition(-1, 0), 1, TileCost{ .mGenerationTime = std::chrono::seconds(1) });
+        EXPECT_TRUE(hasHigherPriority(costly, slow));
+    }
 }
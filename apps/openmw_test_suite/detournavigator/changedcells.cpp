@@ -0,0 +1,122 @@
+#include <components/detournavigator/changedcells.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+    using namespace testing;
+    using namespace DetourNavigator;
+
+    CellFingerprint makeCell(std::string worldspace, const osg::Vec2i& cellPosition, std::byte hash,
+        const TilesPositionsRange& tilesRange = {})
+    {
+        return CellFingerprint{ std::move(worldspace), cellPosition, std::vector<std::byte>{ hash }, tilesRange };
+    }
+
+    CellKey makeKey(const CellFingerprint& cell)
+    {
+        return CellKey(cell.mWorldspace, cell.mCellPosition.x(), cell.mCellPosition.y());
+    }
+
+    TEST(DetourNavigatorGetCellsChangesTest, should_mark_new_cell_as_changed)
+    {
+        const std::vector<CellFingerprint> cells{ makeCell("sys::default", osg::Vec2i(0, 0), std::byte{ 1 }) };
+        const CellsChanges changes = getCellsChanges(cells, {}, { makeKey(cells[0]) });
+        ASSERT_EQ(changes.mCells.size(), 1);
+        EXPECT_TRUE(changes.mCells[0].mChanged);
+        EXPECT_EQ(changes.mCells[0].mPreviousTilesRange, std::nullopt);
+        EXPECT_THAT(changes.mRemovedCells, IsEmpty());
+        EXPECT_THAT(changes.mRemovedWorldspaces, IsEmpty());
+    }
+
+    TEST(DetourNavigatorGetCellsChangesTest, should_provide_previous_tiles_range_for_unchanged_and_changed_cells)
+    {
+        const TilesPositionsRange range{ TilePosition(-3, -3), TilePosition(5, 5) };
+        const std::vector<CellFingerprint> cells{
+            makeCell("sys::default", osg::Vec2i(0, 0), std::byte{ 1 }),
+            makeCell("sys::default", osg::Vec2i(0, 1), std::byte{ 2 }),
+        };
+        const std::vector<CellFingerprint> previousCells{
+            makeCell("sys::default", osg::Vec2i(0, 0), std::byte{ 1 }, range),
+            makeCell("sys::default", osg::Vec2i(0, 1), std::byte{ 3 }, range),
+        };
+        const CellsChanges changes = getCellsChanges(cells, previousCells, { makeKey(cells[0]), makeKey(cells[1]) });
+        ASSERT_EQ(changes.mCells.size(), 2);
+        EXPECT_FALSE(changes.mCells[0].mChanged);
+        EXPECT_EQ(changes.mCells[0].mPreviousTilesRange, range);
+        EXPECT_TRUE(changes.mCells[1].mChanged);
+        EXPECT_EQ(changes.mCells[1].mPreviousTilesRange, range);
+    }
+
+    TEST(DetourNavigatorGetCellsChangesTest, should_not_consider_existing_not_processed_cell_as_removed)
+    {
+        const CellFingerprint interior = makeCell("interior", osg::Vec2i(0, 0), std::byte{ 1 });
+        const CellsChanges changes = getCellsChanges({}, { interior }, { makeKey(interior) });
+        EXPECT_THAT(changes.mRemovedCells, IsEmpty());
+        EXPECT_THAT(changes.mRemovedWorldspaces, IsEmpty());
+    }
+
+    TEST(DetourNavigatorGetCellsChangesTest, should_report_worldspace_of_removed_interior_cell_as_removed)
+    {
+        const CellFingerprint exterior = makeCell("sys::default", osg::Vec2i(0, 0), std::byte{ 1 });
+        const CellFingerprint interior = makeCell("interior", osg::Vec2i(0, 0), std::byte{ 2 });
+        const CellsChanges changes = getCellsChanges({ exterior }, { exterior, interior }, { makeKey(exterior) });
+        ASSERT_EQ(changes.mRemovedCells.size(), 1);
+        EXPECT_EQ(changes.mRemovedCells[0].mWorldspace, "interior");
+        EXPECT_THAT(changes.mRemovedWorldspaces, ElementsAre("interior"));
+    }
+
+    TEST(DetourNavigatorGetCellsChangesTest, should_not_report_worldspace_with_existing_cells_as_removed)
+    {
+        const CellFingerprint cell00 = makeCell("sys::default", osg::Vec2i(0, 0), std::byte{ 1 });
+        const CellFingerprint cell01 = makeCell("sys::default", osg::Vec2i(0, 1), std::byte{ 2 });
+        const CellsChanges changes = getCellsChanges({ cell00 }, { cell00, cell01 }, { makeKey(cell00) });
+        ASSERT_EQ(changes.mRemovedCells.size(), 1);
+        EXPECT_EQ(changes.mRemovedCells[0].mCellPosition, osg::Vec2i(0, 1));
+        EXPECT_THAT(changes.mRemovedWorldspaces, IsEmpty());
+    }
+
+    TEST(DetourNavigatorGetTilesPositionsFromRangesTest, should_return_sorted_unique_union)
+    {
+        const std::vector<TilesPositionsRange> ranges{
+            TilesPositionsRange{ TilePosition(1, 0), TilePosition(3, 1) },
+            TilesPositionsRange{ TilePosition(0, 0), TilePosition(2, 1) },
+        };
+        EXPECT_THAT(getTilesPositions(ranges), ElementsAre(TilePosition(0, 0), TilePosition(1, 0), TilePosition(2, 0)));
+    }
+
+    TEST(DetourNavigatorHasTilesPositionsInRangeTest, should_return_false_for_empty_tiles)
+    {
+        EXPECT_FALSE(hasTilesPositionsInRange({}, TilesPositionsRange{ TilePosition(0, 0), TilePosition(1, 1) }));
+    }
+
+    TEST(DetourNavigatorHasTilesPositionsInRangeTest, should_return_false_for_empty_range)
+    {
+        EXPECT_FALSE(hasTilesPositionsInRange({ TilePosition(0, 0) }, TilesPositionsRange{}));
+    }
+
+    TEST(DetourNavigatorHasTilesPositionsInRangeTest, should_return_true_when_any_tile_is_inside_range)
+    {
+        const std::vector<TilePosition> tiles{ TilePosition(-10, 4), TilePosition(2, 7) };
+        EXPECT_TRUE(hasTilesPositionsInRange(tiles, TilesPositionsRange{ TilePosition(0, 5), TilePosition(3, 8) }));
+    }
+
+    TEST(DetourNavigatorHasTilesPositionsInRangeTest, should_return_false_when_tiles_are_outside_range_by_y)
+    {
+        const std::vector<TilePosition> tiles{ TilePosition(0, 4), TilePosition(1, 8), TilePosition(2, 9) };
+        EXPECT_FALSE(hasTilesPositionsInRange(tiles, TilesPositionsRange{ TilePosition(0, 5), TilePosition(3, 8) }));
+    }
+
+    // Cell far from the changed one with object large enough to reach changed tiles has to be loaded to generate
+    // these tiles with complete input
+    TEST(DetourNavigatorHasTilesPositionsInRangeTest, should_select_far_cell_with_range_covering_changed_tiles)
+    {
+        const TilesPositionsRange changedCellRange{ TilePosition(0, 0), TilePosition(2, 2) };
+        const TilesPositionsRange farCellRange{ TilePosition(-1, -1), TilePosition(12, 12) };
+        const TilesPositionsRange otherFarCellRange{ TilePosition(10, 10), TilePosition(12, 12) };
+        const std::vector<TilePosition> changedTiles = getTilesPositions({ changedCellRange });
+        EXPECT_TRUE(hasTilesPositionsInRange(changedTiles, farCellRange));
+        EXPECT_FALSE(hasTilesPositionsInRange(changedTiles, otherFarCellRange));
+    }
+}
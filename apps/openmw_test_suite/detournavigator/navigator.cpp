@@ -5,6 +5,7 @@
 #include <components/detournavigator/navigatorimpl.hpp>
 #include <components/detournavigator/navigatorutils.hpp>
 #include <components/detournavigator/navmeshdb.hpp>
+#include <components/detournavigator/pathqueryservice.hpp>
 #include <components/esm3/loadland.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
 #include <components/misc/rng.hpp>
@@ -835,6 +836,55 @@ namespace
             << mPath;
     }
 
+    TEST_F(DetourNavigatorNavigatorTest, path_query_service_should_provide_same_path_as_find_path)
+    {
+        const HeightfieldPlane plane{ 100 };
+        const int cellSize = mHeightfieldTileSize * 4;
+
+        ASSERT_TRUE(mNavigator->addAgent(mAgentBounds));
+        mNavigator->addHeightfield(mCellPosition, cellSize, plane, nullptr);
+        mNavigator->update(mPlayerPosition, nullptr);
+        mNavigator->wait(WaitConditionType::requiredTilesPresent, &mListener);
+
+        ASSERT_EQ(findPath(*mNavigator, mAgentBounds, mStart, mEnd, Flag_walk, mAreaCosts, mEndTolerance, mOut),
+            Status::Success);
+
+        PathQueryService service(*mNavigator, 2);
+        const PathQuery query{
+            .mAgentBounds = mAgentBounds,
+            .mStart = mStart,
+            .mEnd = mEnd,
+            .mIncludeFlags = Flag_walk,
+            .mAreaCosts = mAreaCosts,
+            .mEndTolerance = mEndTolerance,
+        };
+        std::vector<std::future<PathQueryResult>> results;
+        for (int i = 0; i < 8; ++i)
+            results.push_back(service.post(query));
+
+        for (std::future<PathQueryResult>& future : results)
+        {
+            const PathQueryResult result = future.get();
+            EXPECT_EQ(result.mStatus, Status::Success);
+            EXPECT_THAT(result.mPath, ElementsAreArray(mPath));
+        }
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, path_query_service_should_report_missing_navmesh)
+    {
+        PathQueryService service(*mNavigator, 1);
+        std::future<PathQueryResult> future = service.post(PathQuery{
+            .mAgentBounds = mAgentBounds,
+            .mStart = mStart,
+            .mEnd = mEnd,
+            .mIncludeFlags = Flag_walk,
+            .mAreaCosts = mAreaCosts,
+            .mEndTolerance = mEndTolerance,
+        });
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        EXPECT_EQ(future.get().mStatus, Status::NavMeshNotFound);
+    }
+
     TEST_F(DetourNavigatorNavigatorTest, for_not_reachable_destination_find_path_should_provide_partial_path)
     {
         const std::array<float, 5 * 5> heightfieldData{ {
@@ -1,6 +1,7 @@
 #include "generate.hpp"
 
 #include <components/detournavigator/navmeshdb.hpp>
+#include <components/misc/compression.hpp>
 
 #include <DetourAlloc.h>
 
@@ -168,6 +169,112 @@ namespace
                     << "x=" << x << " y=" << y;
     }
 
+    TEST_F(DetourNavigatorNavMeshDbTest, compressed_tile_data_should_be_decompressible_to_inserted)
+    {
+        const auto [worldspace, tilePosition, input, data] = insertTile(TileId{ 13 }, TileVersion{ 1 });
+        const auto row = mDb.getCompressedTileData(worldspace, tilePosition, input);
+        ASSERT_TRUE(row.has_value());
+        EXPECT_EQ(Misc::decompress(row->mData), data);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, tiles_with_same_data_should_share_storage)
+    {
+        const TileVersion version{ 1 };
+        const TilePosition tilePosition{ 3, 4 };
+        const std::vector<std::byte> input = generateData();
+        const std::vector<std::byte> data = generateData();
+        ASSERT_EQ(mDb.insertTile(TileId{ 1 }, "sys::default", tilePosition, version, input, data), 1);
+        ASSERT_EQ(mDb.insertTile(TileId{ 2 }, "other", tilePosition, version, input, data), 1);
+        for (const std::string_view worldspace : { "sys::default", "other" })
+        {
+            const auto row = mDb.getTileData(worldspace, tilePosition, input);
+            ASSERT_TRUE(row.has_value()) << worldspace;
+            EXPECT_EQ(row->mData, data) << worldspace;
+        }
+        const TileDataStats stats = mDb.getTileDataStats();
+        EXPECT_EQ(stats.mTiles, 2);
+        EXPECT_EQ(stats.mTileData, 1);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, updated_tile_should_release_not_shared_data)
+    {
+        const TileId tileId{ 13 };
+        const TileVersion version{ 1 };
+        auto [worldspace, tilePosition, input, data] = insertTile(tileId, version);
+        generateRange(data.begin(), data.end(), mRandom);
+        ASSERT_EQ(mDb.updateTile(tileId, version, data), 1);
+        EXPECT_EQ(mDb.getTileDataStats().mTileData, 1);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, deleted_tile_should_release_not_shared_data)
+    {
+        const auto [worldspace, tilePosition, input, data] = insertTile(TileId{ 13 }, TileVersion{ 1 });
+        insertTile(TileId{ 14 }, TileVersion{ 1 });
+        ASSERT_EQ(mDb.getTileDataStats().mTileData, 2);
+        ASSERT_EQ(mDb.deleteTilesAtExcept(worldspace, tilePosition, TileId{ 13 }), 1);
+        EXPECT_EQ(mDb.getTileDataStats().mTileData, 1);
+        EXPECT_EQ(mDb.deleteUnusedTileData(), 0);
+        const auto row = mDb.getTileData(worldspace, tilePosition, input);
+        ASSERT_TRUE(row.has_value());
+        EXPECT_EQ(row->mData, data);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, deleted_tile_should_keep_data_shared_with_other_tile)
+    {
+        const TileVersion version{ 1 };
+        const TilePosition tilePosition{ 3, 4 };
+        const std::vector<std::byte> input = generateData();
+        const std::vector<std::byte> data = generateData();
+        ASSERT_EQ(mDb.insertTile(TileId{ 1 }, "sys::default", tilePosition, version, input, data), 1);
+        ASSERT_EQ(mDb.insertTile(TileId{ 2 }, "other", tilePosition, version, input, data), 1);
+        ASSERT_EQ(mDb.deleteTilesAt("sys::default", tilePosition), 1);
+        EXPECT_EQ(mDb.getTileDataStats().mTileData, 1);
+        const auto row = mDb.getTileData("other", tilePosition, input);
+        ASSERT_TRUE(row.has_value());
+        EXPECT_EQ(row->mData, data);
+        ASSERT_EQ(mDb.deleteTilesAt("other", tilePosition), 1);
+        EXPECT_EQ(mDb.getTileDataStats().mTileData, 0);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, set_cell_fingerprint_should_replace_existing)
+    {
+        const osg::Vec2i cellPosition(-2, 3);
+        const std::vector<std::byte> hash = generateData();
+        const TilesPositionsRange tilesRange{ TilePosition(-10, -3), TilePosition(7, 12) };
+        ASSERT_EQ(mDb.setCellFingerprint(CellFingerprint{ "sys::default", cellPosition, generateData(), {} }), 1);
+        ASSERT_EQ(mDb.setCellFingerprint(CellFingerprint{ "sys::default", cellPosition, hash, tilesRange }), 1);
+        const std::vector<CellFingerprint> fingerprints = mDb.getCellFingerprints();
+        ASSERT_EQ(fingerprints.size(), 1);
+        EXPECT_EQ(fingerprints[0].mWorldspace, "sys::default");
+        EXPECT_EQ(fingerprints[0].mCellPosition, cellPosition);
+        EXPECT_EQ(fingerprints[0].mHash, hash);
+        EXPECT_EQ(fingerprints[0].mTilesRange, tilesRange);
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, delete_cell_fingerprint_should_remove_only_given_cell)
+    {
+        ASSERT_EQ(mDb.setCellFingerprint(CellFingerprint{ "sys::default", osg::Vec2i(0, 0), generateData(), {} }), 1);
+        ASSERT_EQ(mDb.setCellFingerprint(CellFingerprint{ "sys::default", osg::Vec2i(0, 1), generateData(), {} }), 1);
+        ASSERT_EQ(mDb.deleteCellFingerprint("sys::default", osg::Vec2i(0, 0)), 1);
+        const std::vector<CellFingerprint> fingerprints = mDb.getCellFingerprints();
+        ASSERT_EQ(fingerprints.size(), 1);
+        EXPECT_EQ(fingerprints[0].mCellPosition, osg::Vec2i(0, 1));
+    }
+
+    TEST_F(DetourNavigatorNavMeshDbTest, delete_tiles_should_remove_all_worldspace_tiles)
+    {
+        const TileVersion version{ 1 };
+        const std::vector<std::byte> input = generateData();
+        const std::vector<std::byte> data = generateData();
+        ASSERT_EQ(mDb.insertTile(TileId{ 1 }, "interior", TilePosition(0, 0), version, input, data), 1);
+        ASSERT_EQ(mDb.insertTile(TileId{ 2 }, "interior", TilePosition(0, 1), version, input, data), 1);
+        ASSERT_EQ(mDb.insertTile(TileId{ 3 }, "sys::default", TilePosition(0, 0), version, input, data), 1);
+        EXPECT_EQ(mDb.deleteTiles("interior"), 2);
+        EXPECT_FALSE(mDb.findTile("interior", TilePosition(0, 0), input).has_value());
+        EXPECT_FALSE(mDb.findTile("interior", TilePosition(0, 1), input).has_value());
+        EXPECT_TRUE(mDb.findTile("sys::default", TilePosition(0, 0), input).has_value());
+    }
+
     TEST_F(DetourNavigatorNavMeshDbTest, should_support_file_size_limit)
     {
         mDb = NavMeshDb(":memory:", 4096);
@@ -1,6 +1,10 @@
 #include "gmock/gmock.h"
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
 #include <components/lua/luastate.hpp>
 
 #include "../testing_util.hpp"
@@ -223,4 +227,102 @@ return {
         // At this moment all instances of the script should be garbage-collected.
         EXPECT_LT(memWithoutScript, memWithScript);
     }
+
+    TEST(LuaStateBytecodeCacheTest, CompiledScriptShouldBeReusedOnlyForTheSameSource)
+    {
+        const std::filesystem::path cachePath = TestingOpenMW::temporaryFilePath("openmw_lua_bytecode_cache");
+        std::filesystem::remove_all(cachePath);
+        LuaUtil::ScriptsConfiguration cfg;
+        LuaUtil::LuaStateSettings settings;
+        settings.mBytecodeCachePath = cachePath;
+        TestingOpenMW::VFSTestFile script1("return {value = 1}");
+        TestingOpenMW::VFSTestFile script2("return {value = 2}");
+
+        const auto runScript = [&](TestingOpenMW::VFSTestFile& file, std::size_t expectedHits) {
+            const auto vfs = TestingOpenMW::createTestVFS({ { "script.lua", &file } });
+            LuaUtil::LuaState lua(vfs.get(), &cfg, settings);
+            sol::table script = lua.runInNewSandbox("script.lua");
+            EXPECT_EQ(lua.getBytecodeCacheHits(), expectedHits);
+            return script["value"].get<int>();
+        };
+
+        EXPECT_EQ(runScript(script1, 0), 1);
+        EXPECT_FALSE(std::filesystem::is_empty(cachePath));
+        EXPECT_EQ(runScript(script1, 1), 1);
+        EXPECT_EQ(runScript(script2, 0), 2);
+        EXPECT_EQ(runScript(script1, 0), 1);
+        EXPECT_EQ(runScript(script1, 1), 1);
+
+        std::filesystem::remove_all(cachePath);
+    }
+
+    TEST(LuaStateBytecodeCacheTest, DamagedBytecodeShouldBeRejected)
+    {
+        const std::filesystem::path cachePath = TestingOpenMW::temporaryFilePath("openmw_lua_bytecode_cache");
+        std::filesystem::remove_all(cachePath);
+        LuaUtil::ScriptsConfiguration cfg;
+        LuaUtil::LuaStateSettings settings;
+        settings.mBytecodeCachePath = cachePath;
+        TestingOpenMW::VFSTestFile file("return {value = 1}");
+        const auto vfs = TestingOpenMW::createTestVFS({ { "script.lua", &file } });
+
+        {
+            LuaUtil::LuaState lua(vfs.get(), &cfg, settings);
+            lua.runInNewSandbox("script.lua");
+        }
+
+        ASSERT_EQ(std::distance(std::filesystem::directory_iterator(cachePath), {}), 1);
+        const std::filesystem::path cacheFilePath = std::filesystem::directory_iterator(cachePath)->path();
+        std::string content;
+        {
+            std::ifstream stream(cacheFilePath, std::ios::binary);
+            content.assign(std::istreambuf_iterator<char>(stream), {});
+        }
+        {
+            std::string damaged = content;
+            damaged.back() ^= 1;
+            std::ofstream stream(cacheFilePath, std::ios::binary);
+            stream << damaged;
+        }
+
+        {
+            LuaUtil::LuaState lua(vfs.get(), &cfg, settings);
+            sol::table script = lua.runInNewSandbox("script.lua");
+            EXPECT_EQ(script["value"].get<int>(), 1);
+            EXPECT_EQ(lua.getBytecodeCacheHits(), 0);
+        }
+
+        std::ifstream stream(cacheFilePath, std::ios::binary);
+        EXPECT_EQ(std::string(std::istreambuf_iterator<char>(stream), {}), content);
+
+        std::filesystem::remove_all(cachePath);
+    }
+
+    TEST(LuaStateBytecodeCacheTest, StaleFilesShouldBeRemoved)
+    {
+        const std::filesystem::path cachePath = TestingOpenMW::temporaryFilePath("openmw_lua_bytecode_cache");
+        std::filesystem::remove_all(cachePath);
+        LuaUtil::ScriptsConfiguration cfg;
+        LuaUtil::LuaStateSettings settings;
+        settings.mBytecodeCachePath = cachePath;
+        TestingOpenMW::VFSTestFile file("return {value = 1}");
+
+        {
+            const auto vfs = TestingOpenMW::createTestVFS({ { "removed.lua", &file }, { "script.lua", &file } });
+            LuaUtil::LuaState lua(vfs.get(), &cfg, settings);
+            lua.runInNewSandbox("removed.lua");
+            lua.runInNewSandbox("script.lua");
+        }
+        std::ofstream(cachePath / "unfinished.luac.tmp") << "bytecode";
+        ASSERT_EQ(std::distance(std::filesystem::directory_iterator(cachePath), {}), 3);
+
+        const auto vfs = TestingOpenMW::createTestVFS({ { "script.lua", &file } });
+        LuaUtil::LuaState lua(vfs.get(), &cfg, settings);
+        lua.removeStaleBytecodeCacheFiles();
+        EXPECT_EQ(std::distance(std::filesystem::directory_iterator(cachePath), {}), 1);
+        lua.runInNewSandbox("script.lua");
+        EXPECT_EQ(lua.getBytecodeCacheHits(), 1);
+
+        std::filesystem::remove_all(cachePath);
+    }
 }
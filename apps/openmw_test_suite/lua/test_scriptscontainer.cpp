@@ -1,6 +1,8 @@
 #include "gmock/gmock.h"
 #include <gtest/gtest.h>
 
+#include <sstream>
+
 #include <components/esm/luascripts.hpp>
 
 #include <components/lua/asyncpackage.hpp>
@@ -113,6 +115,19 @@ return {
         end,
     },
 }
+)X");
+
+    VFSTestFile loopScript(R"X(
+local function work(n)
+    local sum = 0
+    for i = 1, n do sum = sum + i end
+    return sum
+end
+return {
+    eventHandlers = {
+        Loop = function(eventData) work(eventData.n) end,
+    }
+}
 )X");
 
     struct LuaScriptsContainerTest : Test
@@ -129,6 +144,7 @@ return {
             { "testInterface.lua", &interfaceScript },
             { "overrideInterface.lua", &overrideInterfaceScript },
             { "useInterface.lua", &useInterfaceScript },
+            { "loop.lua", &loopScript },
         });
 
         LuaUtil::ScriptsConfiguration mCfg;
@@ -149,6 +165,7 @@ CUSTOM, NPC: loadSave2.lua
 CUSTOM, PLAYER: testInterface.lua
 CUSTOM, PLAYER: overrideInterface.lua
 CUSTOM, PLAYER: useInterface.lua
+CUSTOM: loop.lua
 )X");
             mCfg.init(std::move(cfg));
         }
@@ -444,6 +461,56 @@ CUSTOM, PLAYER: useInterface.lua
         EXPECT_EQ(counter4, 25);
     }
 
+    TEST_F(LuaScriptsContainerTest, TimerSetUpByTimerCallback)
+    {
+        using TimerType = LuaUtil::ScriptsContainer::TimerType;
+        LuaUtil::ScriptsContainer scripts(&mLua, "Test");
+        int test1Id = *mCfg.findId("test1.lua");
+
+        testing::internal::CaptureStdout();
+        EXPECT_TRUE(scripts.addCustomScript(test1Id));
+        EXPECT_EQ(internal::GetCapturedStdout(), "");
+
+        int counter1 = 0, counter2 = 0;
+        sol::function fn2 = sol::make_object(mLua.sol(), [&]() { counter2++; });
+        sol::function fn1 = sol::make_object(mLua.sol(), [&]() {
+            counter1++;
+            scripts.setupUnsavableTimer(TimerType::SIMULATION_TIME, 1, test1Id, fn2);
+        });
+
+        scripts.setupUnsavableTimer(TimerType::SIMULATION_TIME, 2, test1Id, fn1);
+        scripts.setupUnsavableTimer(TimerType::SIMULATION_TIME, 3, test1Id, fn1);
+
+        scripts.processTimers(5, 0);
+        EXPECT_EQ(counter1, 2);
+        EXPECT_EQ(counter2, 0);
+
+        scripts.processTimers(5, 0);
+        EXPECT_EQ(counter1, 2);
+        EXPECT_EQ(counter2, 2);
+    }
+
+    TEST_F(LuaScriptsContainerTest, SamplingProfiler)
+    {
+        mLua.setSamplingEnabled(true);
+        EXPECT_TRUE(mLua.isSamplingEnabled());
+        LuaUtil::ScriptsContainer scripts(&mLua, "Test");
+        EXPECT_TRUE(scripts.addCustomScript(*mCfg.findId("loop.lua")));
+
+        scripts.receiveEvent("Loop", LuaUtil::serialize(mLua.sol().create_table_with("n", 100000)));
+        mLua.samplingNextFrame();
+
+        const auto handlerTimes = mLua.getHandlerTimes();
+        ASSERT_EQ(handlerTimes.size(), 1u);
+        EXPECT_EQ(handlerTimes[0].first, "Test[loop.lua];Loop");
+        EXPECT_GT(handlerTimes[0].second, 0);
+
+        std::stringstream stacks;
+        mLua.writeSampledStacks(stacks);
+        EXPECT_THAT(stacks.str(), HasSubstr("Test[loop.lua];Loop;"));
+        EXPECT_THAT(stacks.str(), HasSubstr(" work"));
+    }
+
     TEST_F(LuaScriptsContainerTest, CallbackWrapper)
     {
         LuaUtil::Callback callback{ mLua.sol()["print"], mLua.newTable() };
@@ -193,6 +193,31 @@ namespace
         EXPECT_ERROR(lua.safe_script("ro_t.nested.x = 5"), "userdata value");
     }
 
+    TEST(LuaSerializationTest, SerializedTableBuilder)
+    {
+        sol::state lua;
+        sol::table nested(lua, sol::create);
+        nested["x"] = 2;
+
+        LuaUtil::SerializedTableBuilder nestedBuilder;
+        nestedBuilder.add("x", LuaUtil::serialize(sol::make_object(lua, 2)));
+
+        LuaUtil::SerializedTableBuilder builder;
+        builder.add("a", LuaUtil::serialize(sol::make_object(lua, "something")));
+        builder.add("b", LuaUtil::serialize(sol::nil));
+        builder.add("nested", std::move(nestedBuilder).finish());
+        builder.add("nested2", LuaUtil::serialize(nested));
+        EXPECT_ANY_THROW(builder.add("c", "invalid"));
+
+        sol::table res = LuaUtil::deserialize(lua, std::move(builder).finish());
+        EXPECT_EQ(res.get<std::string>("a"), "something");
+        EXPECT_EQ(res.get<sol::object>("b"), sol::nil);
+        EXPECT_EQ(res.get<sol::table>("nested").get<int>("x"), 2);
+        EXPECT_EQ(res.get<sol::table>("nested2").get<int>("x"), 2);
+
+        EXPECT_EQ(LuaUtil::SerializedTableBuilder().finish(), LuaUtil::serialize(sol::table(lua, sol::create)));
+    }
+
     struct TestStruct1
     {
         double a, b;
@@ -111,6 +111,49 @@ namespace
         EXPECT_EQ(get<int>(mLua, "permanent:get('x')"), 1);
         EXPECT_TRUE(get<bool>(mLua, "permanent:get('z') == nil"));
         EXPECT_TRUE(get<bool>(mLua, "temporary:get('y') == nil"));
+
+        std::filesystem::path tmpWriteFile = tmpFile;
+        tmpWriteFile += ".tmp";
+        EXPECT_FALSE(std::filesystem::exists(tmpWriteFile));
+    }
+
+    TEST(LuaUtilStorageTest, SerializeOnlyChangedSections)
+    {
+        sol::state mLua;
+        LuaUtil::LuaStorage::initLuaBindings(mLua);
+        LuaUtil::LuaStorage storage(mLua);
+
+        mLua["a"] = storage.getMutableSection("a");
+        mLua["b"] = storage.getMutableSection("b");
+        mLua.safe_script("a:set('x', 1)");
+        mLua.safe_script("b:set('y', { z = 'abc' })");
+        const LuaUtil::BinaryData data1 = storage.serializePermanentSections();
+        EXPECT_EQ(storage.serializePermanentSections(), data1);
+
+        mLua.safe_script("a:set('x', 2)");
+        const LuaUtil::BinaryData data2 = storage.serializePermanentSections();
+        EXPECT_NE(data2, data1);
+
+        sol::table res = LuaUtil::deserialize(mLua, data2);
+        EXPECT_EQ(res.get<sol::table>("a").get<int>("x"), 2);
+        EXPECT_EQ(res.get<sol::table>("b").get<sol::table>("y").get<std::string>("z"), "abc");
+    }
+
+    TEST(LuaUtilStorageTest, LoadCorrupted)
+    {
+        sol::state mLua;
+        LuaUtil::LuaStorage::initLuaBindings(mLua);
+
+        const auto tmpFile = std::filesystem::temp_directory_path() / "test_storage_corrupted.bin";
+        std::filesystem::path backupFile = tmpFile;
+        backupFile += ".corrupted";
+        std::filesystem::remove(backupFile);
+        LuaUtil::LuaStorage::writeToFile(tmpFile, "invalid data");
+
+        LuaUtil::LuaStorage storage(mLua);
+        storage.load(tmpFile);
+        EXPECT_TRUE(std::filesystem::exists(backupFile));
+        EXPECT_EQ(storage.serializePermanentSections(), LuaUtil::SerializedTableBuilder().finish());
     }
 
 }
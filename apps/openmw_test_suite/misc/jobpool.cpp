@@ -0,0 +1,44 @@
+#include <components/misc/jobpool.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    struct MiscJobPoolTest : TestWithParam<std::size_t>
+    {
+    };
+
+    TEST_P(MiscJobPoolTest, parallelForShouldCallFunctionForEachIndexOnce)
+    {
+        JobPool pool(GetParam());
+        for (std::size_t count : { 0, 1, 2, 100, 1000 })
+        {
+            std::vector<int> calls(count, 0);
+            pool.parallelFor(count, [&](std::size_t index) { ++calls[index]; });
+            EXPECT_THAT(calls, Each(1)) << count;
+        }
+    }
+
+    TEST_P(MiscJobPoolTest, parallelForShouldRethrowException)
+    {
+        JobPool pool(GetParam());
+        EXPECT_THROW(pool.parallelFor(100,
+                         [&](std::size_t index) {
+                             if (index == 42)
+                                 throw std::runtime_error("error");
+                         }),
+            std::runtime_error);
+        std::vector<int> calls(10, 0);
+        pool.parallelFor(calls.size(), [&](std::size_t index) { ++calls[index]; });
+        EXPECT_THAT(calls, Each(1));
+    }
+
+    INSTANTIATE_TEST_SUITE_P(Threads, MiscJobPoolTest, Values(0, 1, 4));
+}
@@ -0,0 +1,120 @@
+#include <components/misc/uniformgrid.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <random>
+
+namespace
+{
+    using namespace testing;
+    using namespace Misc;
+
+    std::vector<std::size_t> findInRange(const UniformGrid<int>& grid, const osg::Vec3f& position, float radius)
+    {
+        std::vector<std::size_t> result;
+        grid.findInRange(position, radius, result);
+        return result;
+    }
+
+    TEST(MiscUniformGridTest, findInRangeForEmptyShouldReturnNothing)
+    {
+        UniformGrid<int> grid(100);
+        grid.build();
+        EXPECT_THAT(findInRange(grid, osg::Vec3f(0, 0, 0), 1000), IsEmpty());
+    }
+
+    TEST(MiscUniformGridTest, findInRangeShouldReturnIndicesWithinRadiusInOrderOfAddition)
+    {
+        UniformGrid<int> grid(100);
+        grid.add(osg::Vec3f(250, 0, 0), 1);
+        grid.add(osg::Vec3f(-50, -50, 0), 2);
+        grid.add(osg::Vec3f(0, 0, 500), 3);
+        grid.add(osg::Vec3f(10, 10, 0), 4);
+        grid.build();
+        EXPECT_THAT(findInRange(grid, osg::Vec3f(0, 0, 0), 100), ElementsAre(1, 3));
+        EXPECT_EQ(grid[3], 4);
+    }
+
+    TEST(MiscUniformGridTest, findInRangeShouldUseDistanceIn3d)
+    {
+        UniformGrid<int> grid(100);
+        grid.add(osg::Vec3f(0, 0, 150), 1);
+        grid.build();
+        EXPECT_THAT(findInRange(grid, osg::Vec3f(0, 0, 0), 100), IsEmpty());
+        EXPECT_THAT(findInRange(grid, osg::Vec3f(0, 0, 0), 150), ElementsAre(0));
+    }
+
+    TEST(MiscUniformGridTest, findInRangeShouldSupportRadiusBeyondIntRange)
+    {
+        UniformGrid<int> grid(1);
+        grid.add(osg::Vec3f(-1e6f, 1e6f, 0), 1);
+        grid.add(osg::Vec3f(1e6f, -1e6f, 0), 2);
+        grid.build();
+        EXPECT_THAT(findInRange(grid, osg::Vec3f(0, 0, 0), std::numeric_limits<float>::max()), ElementsAre(0, 1));
+    }
+
+    TEST(MiscUniformGridTest, findInRangeShouldMatchLinearSearch)
+    {
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> distribution(-10000, 10000);
+        std::vector<osg::Vec3f> positions(1000);
+        UniformGrid<int> grid(512);
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            positions[i] = osg::Vec3f(distribution(random), distribution(random), distribution(random) / 10);
+            grid.add(positions[i], static_cast<int>(i));
+        }
+        grid.build();
+        for (const float radius : { 0.0f, 100.0f, 1000.0f, 7168.0f })
+        {
+            for (const osg::Vec3f& position : positions)
+            {
+                std::vector<std::size_t> expected;
+                for (std::size_t i = 0; i < positions.size(); ++i)
+                    if ((positions[i] - position).length2() <= radius * radius)
+                        expected.push_back(i);
+                EXPECT_EQ(findInRange(grid, position, radius), expected);
+            }
+        }
+    }
+
+    TEST(MiscUniformGridTest, findInRangeWithLargeRadiusShouldMatchLinearSearch)
+    {
+        std::minstd_rand random;
+        for (const float area : { 3 * 8192.0f, 20 * 8192.0f })
+        {
+            std::uniform_real_distribution<float> distribution(0, area);
+            std::vector<osg::Vec3f> positions(1000);
+            UniformGrid<int> grid(512);
+            for (std::size_t i = 0; i < positions.size(); ++i)
+            {
+                positions[i] = osg::Vec3f(distribution(random), distribution(random), 0);
+                grid.add(positions[i], static_cast<int>(i));
+            }
+            grid.build();
+            const float radius = 7168;
+            for (const osg::Vec3f& position : positions)
+            {
+                std::vector<std::size_t> expected;
+                for (std::size_t i = 0; i < positions.size(); ++i)
+                    if ((positions[i] - position).length2() <= radius * radius)
+                        expected.push_back(i);
+                EXPECT_EQ(findInRange(grid, position, radius), expected);
+            }
+        }
+    }
+
+    TEST(MiscUniformGridTest, clearShouldRemoveAllValues)
+    {
+        UniformGrid<int> grid(100);
+        grid.add(osg::Vec3f(0, 0, 0), 1);
+        grid.build();
+        grid.clear();
+        EXPECT_EQ(grid.size(), 0);
+        EXPECT_FALSE(grid.isBuilt());
+        grid.build();
+        EXPECT_THAT(findInRange(grid, osg::Vec3f(0, 0, 0), 100), IsEmpty());
+    }
+}
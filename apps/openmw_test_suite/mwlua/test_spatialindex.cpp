@@ -0,0 +1,112 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "apps/openmw/mwlua/spatialindex.hpp"
+
+namespace MWLua
+{
+    namespace
+    {
+        using namespace testing;
+
+        constexpr ESM::RefNum id1{ 1, 0 };
+        constexpr ESM::RefNum id2{ 2, 0 };
+        constexpr ESM::RefNum id3{ 3, 0 };
+        constexpr ESM::RefNum id4{ 4, 0 };
+
+        struct MWLuaSpatialIndexTest : Test
+        {
+            SpatialIndex mIndex;
+
+            MWLuaSpatialIndexTest()
+            {
+                mIndex.insert(id1, osg::Vec3f(0, 0, 0));
+                mIndex.insert(id2, osg::Vec3f(100, 0, 0));
+                mIndex.insert(id3, osg::Vec3f(-1500, 300, 0));
+                mIndex.insert(id4, osg::Vec3f(5000, -5000, 200));
+            }
+
+            std::vector<ESM::RefNum> findInSphere(const osg::Vec3f& center, float radius) const
+            {
+                std::vector<ESM::RefNum> result;
+                mIndex.findInSphere(center, radius, result);
+                return result;
+            }
+        };
+
+        TEST_F(MWLuaSpatialIndexTest, findInSphereShouldReturnObjectsWithinRadius)
+        {
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), 100), UnorderedElementsAre(id1, id2));
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), 99), UnorderedElementsAre(id1));
+            EXPECT_THAT(findInSphere(osg::Vec3f(-1000, 0, 0), 600), UnorderedElementsAre(id3));
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), 1600), UnorderedElementsAre(id1, id2, id3));
+            EXPECT_THAT(findInSphere(osg::Vec3f(3000, 3000, 3000), 100), IsEmpty());
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, findInSphereShouldTakeZIntoAccount)
+        {
+            EXPECT_THAT(findInSphere(osg::Vec3f(5000, -5000, 0), 199), IsEmpty());
+            EXPECT_THAT(findInSphere(osg::Vec3f(5000, -5000, 0), 200), UnorderedElementsAre(id4));
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, findInSphereWithHugeRadiusShouldReturnAllObjects)
+        {
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), 1e30f), UnorderedElementsAre(id1, id2, id3, id4));
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), std::numeric_limits<float>::infinity()),
+                UnorderedElementsAre(id1, id2, id3, id4));
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, findInSphereShouldUseUpdatedPositions)
+        {
+            EXPECT_TRUE(mIndex.move(id2, osg::Vec3f(200, 0, 0)));
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), 100), UnorderedElementsAre(id1));
+            EXPECT_TRUE(mIndex.move(id4, osg::Vec3f(-1500, 350, 0)));
+            EXPECT_THAT(findInSphere(osg::Vec3f(-1500, 300, 0), 100), UnorderedElementsAre(id3, id4));
+            EXPECT_THAT(findInSphere(osg::Vec3f(5000, -5000, 200), 100), IsEmpty());
+            EXPECT_EQ(mIndex.size(), 4);
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, moveShouldReturnFalseForUnknownObject)
+        {
+            EXPECT_FALSE(mIndex.move(ESM::RefNum{ 5, 0 }, osg::Vec3f(0, 0, 0)));
+            EXPECT_EQ(mIndex.size(), 4);
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, findInSphereShouldNotReturnRemovedObjects)
+        {
+            mIndex.remove(id1);
+            mIndex.remove(id3);
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), 1e30f), UnorderedElementsAre(id2, id4));
+            EXPECT_EQ(mIndex.size(), 2);
+            mIndex.clear();
+            EXPECT_THAT(findInSphere(osg::Vec3f(0, 0, 0), 1e30f), IsEmpty());
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, findInBoxShouldReturnObjectsWithinBox)
+        {
+            std::vector<ESM::RefNum> result;
+            mIndex.findInBox(osg::Vec3f(-2000, -10, -10), osg::Vec3f(50, 1000, 10), result);
+            EXPECT_THAT(result, UnorderedElementsAre(id1, id3));
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, findInConeShouldReturnObjectsWithinCone)
+        {
+            std::vector<ESM::RefNum> result;
+            mIndex.findInCone(osg::Vec3f(-100, 0, 0), osg::Vec3f(1, 0, 0), 0.1f, 1000, result);
+            EXPECT_THAT(result, UnorderedElementsAre(id1, id2));
+            result.clear();
+            mIndex.findInCone(osg::Vec3f(-100, 0, 0), osg::Vec3f(-1, 0, 0), 0.5f, 2000, result);
+            EXPECT_THAT(result, UnorderedElementsAre(id3));
+        }
+
+        TEST_F(MWLuaSpatialIndexTest, findInDistanceShouldReturnSquaredDistances)
+        {
+            std::vector<std::pair<float, ESM::RefNum>> result;
+            mIndex.findInDistance(osg::Vec3f(0, 0, 0), 500, result);
+            EXPECT_THAT(result, UnorderedElementsAre(Pair(0, id1), Pair(10000, id2)));
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "apps/openmw/mwmechanics/pathgrid.hpp"
+
+namespace MWMechanics
+{
+    namespace
+    {
+        using namespace testing;
+
+        void addEdge(ESM::Pathgrid& pathgrid, std::size_t v0, std::size_t v1)
+        {
+            pathgrid.mEdges.push_back(ESM::Pathgrid::Edge{ v0, v1 });
+            pathgrid.mEdges.push_back(ESM::Pathgrid::Edge{ v1, v0 });
+        }
+
+        struct MWMechanicsPathgridGraphTest : Test
+        {
+            ESM::Pathgrid mPathgrid;
+
+            MWMechanicsPathgridGraphTest()
+            {
+                // 0 - 1 - 2   5
+                //      \ /
+                //       3 - 4
+                mPathgrid.mPoints = {
+                    ESM::Pathgrid::Point(0, 0, 0),
+                    ESM::Pathgrid::Point(100, 0, 0),
+                    ESM::Pathgrid::Point(200, 0, 0),
+                    ESM::Pathgrid::Point(150, -100, 0),
+                    ESM::Pathgrid::Point(400, -100, 0),
+                    ESM::Pathgrid::Point(400, 0, 0),
+                };
+                addEdge(mPathgrid, 0, 1);
+                addEdge(mPathgrid, 1, 2);
+                addEdge(mPathgrid, 1, 3);
+                addEdge(mPathgrid, 2, 3);
+                addEdge(mPathgrid, 3, 4);
+            }
+        };
+
+        TEST_F(MWMechanicsPathgridGraphTest, getClosestPointShouldReturnClosestPoint)
+        {
+            const PathgridGraph graph(mPathgrid);
+            EXPECT_EQ(graph.getClosestPoint(osg::Vec3f(-50, 10, 0)), 0);
+            EXPECT_EQ(graph.getClosestPoint(osg::Vec3f(160, -80, 0)), 3);
+            EXPECT_EQ(graph.getClosestPoint(osg::Vec3f(1000, 1000, 0)), 5);
+        }
+
+        TEST_F(MWMechanicsPathgridGraphTest, getClosestPointShouldReturnLowestIndexForEquallyClosePoints)
+        {
+            const PathgridGraph graph(mPathgrid);
+            EXPECT_EQ(graph.getClosestPoint(osg::Vec3f(50, 0, 0)), 0);
+            EXPECT_EQ(graph.getClosestPoint(osg::Vec3f(400, -50, 0)), 4);
+        }
+
+        TEST_F(MWMechanicsPathgridGraphTest, getClosestReachablePointShouldSkipNotConnectedPoints)
+        {
+            const PathgridGraph graph(mPathgrid);
+            using Result = std::pair<std::size_t, bool>;
+            EXPECT_EQ(graph.getClosestReachablePoint(osg::Vec3f(410, 10, 0), 0), Result(4, false));
+            EXPECT_EQ(graph.getClosestReachablePoint(osg::Vec3f(410, 10, 0), 5), Result(5, true));
+            EXPECT_EQ(graph.getClosestReachablePoint(osg::Vec3f(190, 0, 0), 0), Result(2, true));
+        }
+
+        TEST_F(MWMechanicsPathgridGraphTest, findPathShouldReturnShortestPath)
+        {
+            const PathgridGraph graph(mPathgrid);
+            EXPECT_THAT(graph.findPath(0, 4), ElementsAre(0, 1, 3, 4));
+            EXPECT_THAT(graph.findPath(4, 2), ElementsAre(4, 3, 2));
+        }
+
+        TEST_F(MWMechanicsPathgridGraphTest, findPathShouldReturnSinglePointForSameStartAndEnd)
+        {
+            const PathgridGraph graph(mPathgrid);
+            EXPECT_THAT(graph.findPath(2, 2), ElementsAre(2));
+        }
+
+        TEST_F(MWMechanicsPathgridGraphTest, findPathShouldReturnEmptyPathForNotConnectedPoints)
+        {
+            const PathgridGraph graph(mPathgrid);
+            EXPECT_THAT(graph.findPath(0, 5), IsEmpty());
+        }
+
+        TEST_F(MWMechanicsPathgridGraphTest, findPathShouldReturnSamePathWhenCached)
+        {
+            const PathgridGraph graph(mPathgrid);
+            const std::vector<std::size_t> path = graph.findPath(0, 4);
+            EXPECT_EQ(graph.findPath(0, 4), path);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#include <components/sceneutil/textkeymap.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+    using namespace testing;
+    using namespace SceneUtil;
+
+    TEST(SceneUtilTextKeyMapTest, findFirstTimeShouldReturnNulloptForEmpty)
+    {
+        const TextKeyMap map;
+        EXPECT_EQ(map.findFirstTime("idle: start"), std::nullopt);
+    }
+
+    TEST(SceneUtilTextKeyMapTest, findFirstTimeShouldReturnTimeOfMatchingKey)
+    {
+        TextKeyMap map;
+        map.emplace(1, "idle: start");
+        map.emplace(2, "idle: stop");
+        EXPECT_EQ(map.findFirstTime("idle: stop"), 2);
+    }
+
+    TEST(SceneUtilTextKeyMapTest, findFirstTimeShouldReturnEarliestTimeForKeysWithPrefix)
+    {
+        TextKeyMap map;
+        map.emplace(1, "weapononehand: chop start");
+        map.emplace(3, "weapononehand: chop min attack");
+        map.emplace(2, "weapononehand: chop min attack");
+        map.emplace(4, "weapononehand: chop max attack");
+        EXPECT_EQ(map.findFirstTime("weapononehand: chop m"), 2);
+    }
+
+    TEST(SceneUtilTextKeyMapTest, findFirstTimeShouldIgnoreKeysWithoutPrefix)
+    {
+        TextKeyMap map;
+        map.emplace(1, "idle: start");
+        map.emplace(2, "idle2: start");
+        EXPECT_EQ(map.findFirstTime("idle3"), std::nullopt);
+        EXPECT_EQ(map.findFirstTime("idle2"), 2);
+    }
+}
@@ -9,6 +9,7 @@
 
 #include <components/debug/debuglog.hpp>
 #include <components/loadinglistener/loadinglistener.hpp>
+#include <components/misc/compression.hpp>
 #include <components/misc/strings/conversion.hpp>
 #include <components/misc/thread.hpp>
 
@@ -49,15 +50,19 @@ namespace DetourNavigator
             return false;
         }
 
-        auto getPriority(const Job& job) noexcept
+        // Generating a tile which is updated repeatedly (e.g. because of a rotating object) should not take more than
+        // this share of a single thread time.
+        constexpr int maxUpdateTimeShareDivisor = 4;
+
+        std::chrono::steady_clock::duration getMinUpdateInterval(const Settings& settings, const TileCost& cost)
         {
-            return std::make_tuple(-static_cast<std::underlying_type_t<JobState>>(job.mState), job.mProcessTime,
-                job.mChangeType, job.mTryNumber, job.mDistanceToPlayer, job.mDistanceToOrigin);
+            return std::max<std::chrono::steady_clock::duration>(
+                settings.mMinUpdateInterval, cost.mGenerationTime * maxUpdateTimeShareDivisor);
         }
 
         struct LessByJobPriority
         {
-            bool operator()(JobIt lhs, JobIt rhs) const noexcept { return getPriority(*lhs) < getPriority(*rhs); }
+            bool operator()(JobIt lhs, JobIt rhs) const noexcept { return hasHigherPriority(*lhs, *rhs); }
         };
 
         void insertPrioritizedJob(JobIt job, std::deque<JobIt>& queue)
@@ -68,8 +73,8 @@ namespace DetourNavigator
 
         auto getDbPriority(const Job& job) noexcept
         {
-            return std::make_tuple(static_cast<std::underlying_type_t<JobState>>(job.mState), job.mChangeType,
-                job.mDistanceToPlayer, job.mDistanceToOrigin);
+            return std::make_tuple(static_cast<std::underlying_type_t<JobState>>(job.mState), !job.mRequired,
+                job.mChangeType, job.mDistanceToPlayer, job.mDistanceToOrigin);
         }
 
         struct LessByJobDbPriority
@@ -113,6 +118,19 @@ namespace DetourNavigator
             return nextJobId.fetch_add(1);
         }
 
+        bool deserializeCachedTileData(const Job& job, PreparedNavMeshData& value)
+        {
+            try
+            {
+                return deserialize(Misc::decompress(job.mCachedTileData->mData), value);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Warning) << "Failed to decompress db tile data for job " << job.mId << ": " << e.what();
+                return false;
+            }
+        }
+
         bool isWritingDbJob(const Job& job)
         {
             return job.mGeneratedNavMeshData != nullptr;
@@ -133,15 +151,28 @@ namespace DetourNavigator
         return stream << "JobStatus::" << static_cast<std::underlying_type_t<JobStatus>>(value);
     }
 
+    bool hasHigherPriority(const Job& lhs, const Job& rhs) noexcept
+    {
+        // Tiles required to find a path go first, then closer to the player and cheaper to generate ones
+        const auto getPriority = [](const Job& job) {
+            return std::make_tuple(-static_cast<std::underlying_type_t<JobState>>(job.mState), job.mProcessTime,
+                !job.mRequired, job.mChangeType, job.mTryNumber, job.mDistanceToPlayer, job.mCost.mGenerationTime,
+                job.mCost.mTriangles, job.mDistanceToOrigin);
+        };
+        return getPriority(lhs) < getPriority(rhs);
+    }
+
     Job::Job(const AgentBounds& agentBounds, std::weak_ptr<GuardedNavMeshCacheItem> navMeshCacheItem,
         std::string_view worldspace, const TilePosition& changedTile, ChangeType changeType, int distanceToPlayer,
-        std::chrono::steady_clock::time_point processTime)
+        std::chrono::steady_clock::time_point processTime, const TileCost& cost)
         : mId(getNextJobId())
         , mAgentBounds(agentBounds)
         , mNavMeshCacheItem(std::move(navMeshCacheItem))
         , mWorldspace(worldspace)
         , mChangedTile(changedTile)
         , mProcessTime(processTime)
+        , mPostTime(std::chrono::steady_clock::now())
+        , mCost(cost)
         , mChangeType(changeType)
         , mDistanceToPlayer(distanceToPlayer)
         , mDistanceToOrigin(getManhattanDistance(changedTile, TilePosition{ 0, 0 }))
@@ -192,12 +223,15 @@ namespace DetourNavigator
         {
             if (mPushed.emplace(agentBounds, changedTile).second)
             {
+                const auto costIt = mTileCosts.find(std::tie(agentBounds, changedTile));
+                const TileCost cost = costIt == mTileCosts.end() ? TileCost{} : costIt->second;
+
                 const auto processTime = changeType == ChangeType::update
-                    ? mLastUpdates[std::tie(agentBounds, changedTile)] + mSettings.get().mMinUpdateInterval
+                    ? mLastUpdates[std::tie(agentBounds, changedTile)] + getMinUpdateInterval(mSettings, cost)
                     : std::chrono::steady_clock::time_point();
 
                 const JobIt it = mJobs.emplace(mJobs.end(), agentBounds, navMeshCacheItem, worldspace, changedTile,
-                    changeType, getManhattanDistance(changedTile, playerTile), processTime);
+                    changeType, getManhattanDistance(changedTile, playerTile), processTime, cost);
 
                 Log(Debug::Debug) << "Post job " << it->mId << " for agent=(" << it->mAgentBounds << ")"
                                   << " changedTile=(" << it->mChangedTile << ") "
@@ -224,6 +258,41 @@ namespace DetourNavigator
             mDbWorker->updateJobs(playerTile, maxTiles);
     }
 
+    void AsyncNavMeshUpdater::prioritize(const AgentBounds& agentBounds, std::span<const TilePosition> tiles)
+    {
+        const std::lock_guard lock(mMutex);
+
+        // Usually there are no waiting jobs for these tiles, find it out without going over all waiting jobs.
+        // Jobs returned by the db worker are not in mPushed and keep their priority.
+        std::vector<TilePosition> pushedTiles;
+        for (const TilePosition& tile : tiles)
+            if (mPushed.contains(std::tie(agentBounds, tile)))
+                pushedTiles.push_back(tile);
+
+        if (pushedTiles.empty())
+            return;
+
+        std::sort(pushedTiles.begin(), pushedTiles.end());
+
+        bool changed = false;
+
+        for (JobIt job : mWaiting)
+        {
+            if (job->mRequired || job->mAgentBounds != agentBounds
+                || !std::binary_search(pushedTiles.begin(), pushedTiles.end(), job->mChangedTile))
+                continue;
+
+            Log(Debug::Debug) << "Prioritize job " << job->mId << " for agent=(" << job->mAgentBounds << ")"
+                              << " changedTile=(" << job->mChangedTile << ")";
+
+            job->mRequired = true;
+            changed = true;
+        }
+
+        if (changed)
+            std::sort(mWaiting.begin(), mWaiting.end(), LessByJobPriority{});
+    }
+
     void AsyncNavMeshUpdater::wait(WaitConditionType waitConditionType, Loading::Listener* listener)
     {
         switch (waitConditionType)
@@ -321,6 +390,7 @@ namespace DetourNavigator
             result.mDb = mDbWorker->getStats();
         result.mCache = mNavMeshTilesCache.getStats();
         result.mDbGetTileHits = mDbGetTileHits.load(std::memory_order_relaxed);
+        result.mLatency = *mLatency.lockConst();
         return result;
     }
 
@@ -340,6 +410,7 @@ namespace DetourNavigator
                     {
                         case JobStatus::Done:
                             unlockTile(job->mId, job->mAgentBounds, job->mChangedTile);
+                            reportJobDone(*job);
                             if (job->mGeneratedNavMeshData != nullptr)
                                 mDbWorker->enqueueJob(job);
                             else
@@ -433,9 +504,13 @@ namespace DetourNavigator
                 return JobStatus::MemoryCacheMiss;
             }
 
+            const auto start = std::chrono::steady_clock::now();
+
             preparedNavMeshData = prepareNavMeshTileData(
                 *recastMesh, job.mWorldspace, job.mChangedTile, job.mAgentBounds, mSettings.get().mRecast);
 
+            setTileCost(job, *recastMesh, std::chrono::steady_clock::now() - start);
+
             if (preparedNavMeshData == nullptr)
             {
                 Log(Debug::Debug) << "Null navmesh data for job " << job.mId;
@@ -477,16 +552,22 @@ namespace DetourNavigator
         if (job.mCachedTileData.has_value() && job.mCachedTileData->mVersion == navMeshFormatVersion)
         {
             preparedNavMeshData = std::make_unique<PreparedNavMeshData>();
-            if (deserialize(job.mCachedTileData->mData, *preparedNavMeshData))
+            if (deserializeCachedTileData(job, *preparedNavMeshData))
+            {
+                // Tile id is not stored with the data to allow tiles with the same content to share it
+                preparedNavMeshData->mUserId = static_cast<unsigned>(job.mCachedTileData->mTileId);
                 ++mDbGetTileHits;
+            }
             else
                 preparedNavMeshData = nullptr;
         }
 
         if (preparedNavMeshData == nullptr)
         {
+            const auto start = std::chrono::steady_clock::now();
             preparedNavMeshData = prepareNavMeshTileData(
                 *job.mRecastMesh, job.mWorldspace, job.mChangedTile, job.mAgentBounds, mSettings.get().mRecast);
+            setTileCost(job, *job.mRecastMesh, std::chrono::steady_clock::now() - start);
             generatedNavMeshData = true;
         }
 
@@ -612,6 +693,24 @@ namespace DetourNavigator
                 writeToFile(shared->lockConst()->getImpl(), mSettings.get().mNavMeshPathPrefix, navMeshRevision);
     }
 
+    void AsyncNavMeshUpdater::setTileCost(
+        const Job& job, const RecastMesh& recastMesh, std::chrono::steady_clock::duration generationTime)
+    {
+        const TileCost cost{
+            .mTriangles = recastMesh.getMesh().getIndices().size() / 3,
+            .mGenerationTime = generationTime,
+        };
+        const std::lock_guard lock(mMutex);
+        mTileCosts[getAgentAndTile(job)] = cost;
+    }
+
+    void AsyncNavMeshUpdater::reportJobDone(const Job& job)
+    {
+        const auto latency = std::chrono::steady_clock::now() - job.mPostTime;
+        auto locked = mLatency.lock();
+        (job.mRequired ? locked->mRequired : locked->mRegular).add(latency);
+    }
+
     void AsyncNavMeshUpdater::repost(JobIt job)
     {
         unlockTile(job->mId, job->mAgentBounds, job->mChangedTile);
@@ -665,11 +764,24 @@ namespace DetourNavigator
 
         for (auto it = mLastUpdates.begin(); it != mLastUpdates.end();)
         {
-            if (now - it->second > mSettings.get().mMinUpdateInterval)
+            const auto costIt = mTileCosts.find(it->first);
+            const TileCost cost = costIt == mTileCosts.end() ? TileCost{} : costIt->second;
+            if (now - it->second > getMinUpdateInterval(mSettings, cost))
                 it = mLastUpdates.erase(it);
             else
                 ++it;
         }
+
+        // Cost is used only to order and space jobs for tiles which are present or going to be generated
+        const auto processingTiles = mProcessingTiles.lockConst();
+        for (auto it = mTileCosts.begin(); it != mTileCosts.end();)
+        {
+            if (!mPresentTiles.contains(it->first) && !mPushed.contains(it->first)
+                && !mLastUpdates.contains(it->first) && !processingTiles->contains(it->first))
+                it = mTileCosts.erase(it);
+            else
+                ++it;
+        }
     }
 
     void AsyncNavMeshUpdater::enqueueJob(JobIt job)
@@ -874,7 +986,8 @@ namespace DetourNavigator
             }
         }
 
-        job->mCachedTileData = mDb->getTileData(job->mWorldspace, job->mChangedTile, job->mInput);
+        // Decompression is done by the updater threads to keep db worker busy only with the db access
+        job->mCachedTileData = mDb->getCompressedTileData(job->mWorldspace, job->mChangedTile, job->mInput);
     }
 
     void DbWorker::processWritingJob(JobIt job)
@@ -899,7 +1012,6 @@ namespace DetourNavigator
         if (const auto& cachedTileData = job->mCachedTileData)
         {
             Log(Debug::Debug) << "Update db tile by job " << job->mId;
-            job->mGeneratedNavMeshData->mUserId = cachedTileData->mTileId;
             mDb->updateTile(cachedTileData->mTileId, mVersion, serialize(*job->mGeneratedNavMeshData));
             return;
         }
@@ -911,7 +1023,6 @@ namespace DetourNavigator
             return;
         }
 
-        job->mGeneratedNavMeshData->mUserId = mNextTileId;
         Log(Debug::Debug) << "Insert db tile by job " << job->mId;
         mDb->insertTile(mNextTileId, job->mWorldspace, job->mChangedTile, mVersion, job->mInput,
             serialize(*job->mGeneratedNavMeshData));
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <optional>
 #include <set>
+#include <span>
 #include <thread>
 #include <tuple>
 
@@ -42,6 +43,12 @@ namespace DetourNavigator
         WithDbResult,
     };
 
+    struct TileCost
+    {
+        std::size_t mTriangles = 0;
+        std::chrono::steady_clock::duration mGenerationTime{};
+    };
+
     struct Job
     {
         const std::size_t mId;
@@ -50,7 +57,10 @@ namespace DetourNavigator
         const std::string mWorldspace;
         const TilePosition mChangedTile;
         const std::chrono::steady_clock::time_point mProcessTime;
+        const std::chrono::steady_clock::time_point mPostTime;
+        const TileCost mCost;
         unsigned mTryNumber = 0;
+        bool mRequired = false;
         ChangeType mChangeType;
         int mDistanceToPlayer;
         const int mDistanceToOrigin;
@@ -62,11 +72,14 @@ namespace DetourNavigator
 
         Job(const AgentBounds& agentBounds, std::weak_ptr<GuardedNavMeshCacheItem> navMeshCacheItem,
             std::string_view worldspace, const TilePosition& changedTile, ChangeType changeType, int distanceToPlayer,
-            std::chrono::steady_clock::time_point processTime);
+            std::chrono::steady_clock::time_point processTime, const TileCost& cost = TileCost{});
     };
 
     using JobIt = std::list<Job>::iterator;
 
+    // Returns true when lhs job has to be processed before rhs
+    bool hasHigherPriority(const Job& lhs, const Job& rhs) noexcept;
+
     enum class JobStatus
     {
         Done,
@@ -149,6 +162,9 @@ namespace DetourNavigator
             const TilePosition& playerTile, std::string_view worldspace,
             const std::map<TilePosition, ChangeType>& changedTiles);
 
+        /// Moves waiting jobs for given tiles ahead of the others. Used for tiles required to find a path.
+        void prioritize(const AgentBounds& agentBounds, std::span<const TilePosition> tiles);
+
         void wait(WaitConditionType waitConditionType, Loading::Listener* listener);
 
         void stop();
@@ -176,6 +192,8 @@ namespace DetourNavigator
         Misc::ScopeGuarded<std::set<std::tuple<AgentBounds, TilePosition>>> mProcessingTiles;
         std::map<std::tuple<AgentBounds, TilePosition>, std::chrono::steady_clock::time_point> mLastUpdates;
         std::set<std::tuple<AgentBounds, TilePosition>> mPresentTiles;
+        std::map<std::tuple<AgentBounds, TilePosition>, TileCost> mTileCosts;
+        Misc::ScopeGuarded<JobsLatencyStats> mLatency;
         std::vector<std::thread> mThreads;
         std::unique_ptr<DbWorker> mDbWorker;
         std::atomic_size_t mDbGetTileHits{ 0 };
@@ -197,6 +215,11 @@ namespace DetourNavigator
 
         void writeDebugFiles(const Job& job, const RecastMesh* recastMesh) const;
 
+        void setTileCost(
+            const Job& job, const RecastMesh& recastMesh, std::chrono::steady_clock::duration generationTime);
+
+        void reportJobDone(const Job& job);
+
         void repost(JobIt job);
 
         bool lockTile(std::size_t jobId, const AgentBounds& agentBounds, const TilePosition& changedTile);
@@ -0,0 +1,71 @@
+#include "changedcells.hpp"
+#include "gettilespositions.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace DetourNavigator
+{
+    CellsChanges getCellsChanges(const std::vector<CellFingerprint>& cells,
+        const std::vector<CellFingerprint>& previousCells, const std::set<CellKey>& existingCells)
+    {
+        CellsChanges result;
+
+        std::map<CellKey, const CellFingerprint*> previous;
+        std::set<std::string> removedWorldspaces;
+        for (const CellFingerprint& v : previousCells)
+        {
+            CellKey key(v.mWorldspace, v.mCellPosition.x(), v.mCellPosition.y());
+            if (existingCells.find(key) == existingCells.end())
+            {
+                result.mRemovedCells.push_back(v);
+                removedWorldspaces.insert(v.mWorldspace);
+            }
+            else
+                previous.emplace(std::move(key), &v);
+        }
+
+        for (const CellKey& v : existingCells)
+            removedWorldspaces.erase(std::get<0>(v));
+
+        result.mRemovedWorldspaces.assign(removedWorldspaces.begin(), removedWorldspaces.end());
+
+        result.mCells.reserve(cells.size());
+        for (const CellFingerprint& v : cells)
+        {
+            CellChange& change = result.mCells.emplace_back();
+            const auto it = previous.find(CellKey(v.mWorldspace, v.mCellPosition.x(), v.mCellPosition.y()));
+            if (it == previous.end())
+                continue;
+            change.mChanged = it->second->mHash != v.mHash;
+            change.mPreviousTilesRange = it->second->mTilesRange;
+        }
+
+        return result;
+    }
+
+    std::vector<TilePosition> getTilesPositions(const std::vector<TilesPositionsRange>& ranges)
+    {
+        std::vector<TilePosition> result;
+        for (const TilesPositionsRange& range : ranges)
+            getTilesPositions(range, [&](const TilePosition& tilePosition) { result.push_back(tilePosition); });
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        return result;
+    }
+
+    bool hasTilesPositionsInRange(
+        const std::vector<TilePosition>& sortedTilesPositions, const TilesPositionsRange& range)
+    {
+        for (int x = range.mBegin.x(); x < range.mEnd.x(); ++x)
+        {
+            const auto it = std::lower_bound(
+                sortedTilesPositions.begin(), sortedTilesPositions.end(), TilePosition(x, range.mBegin.y()));
+            if (it == sortedTilesPositions.end())
+                return false;
+            if (it->x() == x && it->y() < range.mEnd.y())
+                return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_CHANGEDCELLS_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_CHANGEDCELLS_H
+
+#include "navmeshdb.hpp"
+#include "tileposition.hpp"
+#include "tilespositionsrange.hpp"
+
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace DetourNavigator
+{
+    // Worldspace and cell position
+    using CellKey = std::tuple<std::string, int, int>;
+
+    struct CellChange
+    {
+        bool mChanged = true;
+        // Tiles affected by the cell content when it was processed last time
+        std::optional<TilesPositionsRange> mPreviousTilesRange;
+    };
+
+    struct CellsChanges
+    {
+        // Same order as the cells passed to getCellsChanges
+        std::vector<CellChange> mCells;
+        std::vector<CellFingerprint> mRemovedCells;
+        // Worldspaces without any existing cell, none of their tiles are used anymore
+        std::vector<std::string> mRemovedWorldspaces;
+    };
+
+    // Cells present in previousCells but not in existingCells are removed. Cells present in existingCells but not in
+    // cells are not processed and not considered as removed.
+    CellsChanges getCellsChanges(const std::vector<CellFingerprint>& cells,
+        const std::vector<CellFingerprint>& previousCells, const std::set<CellKey>& existingCells);
+
+    // Returns sorted unique positions of the tiles covered by any of the ranges
+    std::vector<TilePosition> getTilesPositions(const std::vector<TilesPositionsRange>& ranges);
+
+    bool hasTilesPositionsInRange(
+        const std::vector<TilePosition>& sortedTilesPositions, const TilesPositionsRange& range);
+}
+
+#endif
@@ -181,6 +181,16 @@ namespace DetourNavigator
          */
         virtual void wait(WaitConditionType waitConditionType, Loading::Listener* listener) = 0;
 
+        /**
+         * @brief prioritizeTiles makes navmesh tiles along the segment to be generated before the others.
+         * Used when a path can't be found because these tiles are not ready yet.
+         * @param agentBounds defines navmesh to update
+         * @param start of the segment in world coordinates
+         * @param end of the segment in world coordinates
+         */
+        virtual void prioritizeTiles(const AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end)
+            = 0;
+
         /**
          * @brief getNavMesh returns navmesh for specific agent half extents
          * @return navmesh
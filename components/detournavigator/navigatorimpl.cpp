@@ -159,6 +159,11 @@ namespace DetourNavigator
         mNavMeshManager.wait(waitConditionType, listener);
     }
 
+    void NavigatorImpl::prioritizeTiles(const AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end)
+    {
+        mNavMeshManager.prioritizeTiles(agentBounds, start, end);
+    }
+
     SharedNavMeshCacheItem NavigatorImpl::getNavMesh(const AgentBounds& agentBounds) const
     {
         return mNavMeshManager.getNavMesh(agentBounds);
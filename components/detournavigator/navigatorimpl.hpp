@@ -63,6 +63,8 @@ namespace DetourNavigator
 
         void wait(WaitConditionType waitConditionType, Loading::Listener* listener) override;
 
+        void prioritizeTiles(const AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end) override;
+
         SharedNavMeshCacheItem getNavMesh(const AgentBounds& agentBounds) const override;
 
         std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const override;
@@ -8,10 +8,17 @@
 
 #include <DetourAlloc.h>
 
+#include <extern/smhasher/MurmurHash3.h>
+
 #include <sqlite3.h>
 
+#include <array>
 #include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 namespace DetourNavigator
@@ -29,7 +36,8 @@ namespace DetourNavigator
                 tile_position_y INTEGER NOT NULL,
                 version INTEGER NOT NULL,
                 input BLOB,
-                data BLOB
+                data BLOB,
+                tile_data_id INTEGER
             );
 
             CREATE UNIQUE INDEX IF NOT EXISTS index_unique_tiles_by_worldspace_and_tile_position_and_input
@@ -48,6 +56,82 @@ namespace DetourNavigator
             CREATE UNIQUE INDEX IF NOT EXISTS index_unique_shapes_by_name_and_type_and_hash
                 ON shapes (name, type, hash);
 
+            CREATE TABLE IF NOT EXISTS tile_data (
+                tile_data_id INTEGER PRIMARY KEY,
+                hash BLOB NOT NULL,
+                data BLOB NOT NULL
+            );
+
+            CREATE UNIQUE INDEX IF NOT EXISTS index_unique_tile_data_by_hash
+                ON tile_data (hash);
+
+            COMMIT;
+        )";
+
+        // Databases created before tile_data table was introduced store compressed tile data in tiles.data column.
+        // Such tiles are still readable and are moved to tile_data by NavMeshDb::migrateTileData.
+        constexpr const char addTileDataIdColumn[] = R"(
+            ALTER TABLE tiles ADD COLUMN tile_data_id INTEGER;
+        )";
+
+        // Version 1: tile_data rows are deleted by the triggers when the last tile referencing them is deleted or
+        // updated. The rows left by the tiles replaced before the triggers were added are deleted by the migration.
+        constexpr const char migrateToVersion1[] = R"(
+            BEGIN TRANSACTION;
+
+            CREATE INDEX IF NOT EXISTS index_tiles_by_tile_data_id
+                ON tiles (tile_data_id);
+
+            CREATE TRIGGER IF NOT EXISTS delete_unused_tile_data_after_tile_delete
+                AFTER DELETE ON tiles
+                WHEN old.tile_data_id IS NOT NULL
+            BEGIN
+                DELETE FROM tile_data
+                 WHERE tile_data_id = old.tile_data_id
+                   AND NOT EXISTS (SELECT 1 FROM tiles WHERE tiles.tile_data_id = old.tile_data_id);
+            END;
+
+            CREATE TRIGGER IF NOT EXISTS delete_unused_tile_data_after_tile_update
+                AFTER UPDATE OF tile_data_id ON tiles
+                WHEN old.tile_data_id IS NOT NULL AND old.tile_data_id IS NOT new.tile_data_id
+            BEGIN
+                DELETE FROM tile_data
+                 WHERE tile_data_id = old.tile_data_id
+                   AND NOT EXISTS (SELECT 1 FROM tiles WHERE tiles.tile_data_id = old.tile_data_id);
+            END;
+
+            DELETE FROM tile_data
+             WHERE NOT EXISTS (SELECT 1 FROM tiles WHERE tiles.tile_data_id = tile_data.tile_data_id);
+
+            PRAGMA user_version = 1;
+
+            COMMIT;
+        )";
+
+        // Version 2: cells store range of the tiles affected by the cell content to find the tiles to update when
+        // any cell affecting them is changed or removed. Fingerprints stored by the previous version don't have it and
+        // are dropped, next incremental run processes all cells.
+        constexpr const char migrateToVersion2[] = R"(
+            BEGIN TRANSACTION;
+
+            DROP TABLE IF EXISTS cells;
+
+            CREATE TABLE cells (
+                worldspace TEXT NOT NULL,
+                cell_position_x INTEGER NOT NULL,
+                cell_position_y INTEGER NOT NULL,
+                hash BLOB NOT NULL,
+                tiles_begin_x INTEGER NOT NULL,
+                tiles_begin_y INTEGER NOT NULL,
+                tiles_end_x INTEGER NOT NULL,
+                tiles_end_y INTEGER NOT NULL
+            );
+
+            CREATE UNIQUE INDEX index_unique_cells_by_worldspace_and_cell_position
+                ON cells (worldspace, cell_position_x, cell_position_y);
+
+            PRAGMA user_version = 2;
+
             COMMIT;
         )";
 
@@ -65,27 +149,70 @@ namespace DetourNavigator
         )";
 
         constexpr std::string_view getTileDataQuery = R"(
-            SELECT tile_id, version, data
+            SELECT tiles.tile_id, tiles.version, coalesce(tile_data.data, tiles.data)
               FROM tiles
-             WHERE worldspace = :worldspace
-               AND tile_position_x = :tile_position_x
-               AND tile_position_y = :tile_position_y
-               AND input = :input
+              LEFT JOIN tile_data ON tile_data.tile_data_id = tiles.tile_data_id
+             WHERE tiles.worldspace = :worldspace
+               AND tiles.tile_position_x = :tile_position_x
+               AND tiles.tile_position_y = :tile_position_y
+               AND tiles.input = :input
         )";
 
         constexpr std::string_view insertTileQuery = R"(
-            INSERT INTO tiles ( tile_id,  worldspace,  version,  tile_position_x,  tile_position_y,  input,  data)
-                   VALUES     (:tile_id, :worldspace, :version, :tile_position_x, :tile_position_y, :input, :data)
+            INSERT INTO tiles ( tile_id,  worldspace,  version,  tile_position_x,  tile_position_y,  input,
+                                tile_data_id)
+                   VALUES     (:tile_id, :worldspace, :version, :tile_position_x, :tile_position_y, :input,
+                               :tile_data_id)
         )";
 
         constexpr std::string_view updateTileQuery = R"(
             UPDATE tiles
                SET version = :version,
-                   data = :data,
+                   data = NULL,
+                   tile_data_id = :tile_data_id,
                    revision = revision + 1
              WHERE tile_id = :tile_id
         )";
 
+        constexpr std::string_view setTileDataIdQuery = R"(
+            UPDATE tiles
+               SET data = NULL,
+                   tile_data_id = :tile_data_id
+             WHERE tile_id = :tile_id
+        )";
+
+        constexpr std::string_view getTilesWithInlineDataQuery = R"(
+            SELECT tile_id, data
+              FROM tiles
+             WHERE tile_data_id IS NULL
+               AND data IS NOT NULL
+             LIMIT :limit
+        )";
+
+        constexpr std::string_view findTileDataIdQuery = R"(
+            SELECT tile_data_id
+              FROM tile_data
+             WHERE hash = :hash
+        )";
+
+        constexpr std::string_view insertTileDataQuery = R"(
+            INSERT INTO tile_data ( hash,  data)
+                   VALUES         (:hash, :data)
+        )";
+
+        constexpr std::string_view deleteUnusedTileDataQuery = R"(
+            DELETE FROM tile_data
+             WHERE NOT EXISTS (SELECT 1 FROM tiles WHERE tiles.tile_data_id = tile_data.tile_data_id)
+        )";
+
+        constexpr std::string_view getTileDataStatsQuery = R"(
+            SELECT (SELECT count(*) FROM tiles),
+                   (SELECT count(*) FROM tile_data),
+                   (SELECT coalesce(sum(length(data)), 0) FROM tile_data)
+                       + (SELECT coalesce(sum(length(data)), 0) FROM tiles),
+                   (SELECT page_count * page_size FROM pragma_page_count(), pragma_page_size())
+        )";
+
         constexpr std::string_view deleteTilesAtQuery = R"(
             DELETE FROM tiles
              WHERE worldspace = :worldspace
@@ -93,6 +220,11 @@ namespace DetourNavigator
                AND tile_position_y = :tile_position_y
         )";
 
+        constexpr std::string_view deleteTilesQuery = R"(
+            DELETE FROM tiles
+             WHERE worldspace = :worldspace
+        )";
+
         constexpr std::string_view deleteTilesAtExceptQuery = R"(
             DELETE FROM tiles
              WHERE worldspace = :worldspace
@@ -128,6 +260,26 @@ namespace DetourNavigator
                    VALUES      (:shape_id, :name, :type, :hash)
         )";
 
+        constexpr std::string_view getCellFingerprintsQuery = R"(
+            SELECT worldspace, cell_position_x, cell_position_y, hash,
+                   tiles_begin_x, tiles_begin_y, tiles_end_x, tiles_end_y
+              FROM cells
+        )";
+
+        constexpr std::string_view setCellFingerprintQuery = R"(
+            INSERT OR REPLACE INTO cells ( worldspace,  cell_position_x,  cell_position_y,  hash,
+                                           tiles_begin_x,  tiles_begin_y,  tiles_end_x,  tiles_end_y)
+                               VALUES    (:worldspace, :cell_position_x, :cell_position_y, :hash,
+                                          :tiles_begin_x, :tiles_begin_y, :tiles_end_x, :tiles_end_y)
+        )";
+
+        constexpr std::string_view deleteCellFingerprintQuery = R"(
+            DELETE FROM cells
+             WHERE worldspace = :worldspace
+               AND cell_position_x = :cell_position_x
+               AND cell_position_y = :cell_position_y
+        )";
+
         constexpr std::string_view vacuumQuery = R"(
             VACUUM;
         )";
@@ -152,6 +304,71 @@ namespace DetourNavigator
             if (const int ec = sqlite3_exec(&db, query.c_str(), nullptr, nullptr, nullptr); ec != SQLITE_OK)
                 throw std::runtime_error("Failed set max page count: " + std::string(sqlite3_errmsg(&db)));
         }
+
+        struct HasTileDataIdColumn
+        {
+            static std::string_view text() noexcept
+            {
+                return "SELECT count(*) FROM pragma_table_info('tiles') WHERE name = 'tile_data_id';";
+            }
+            static void bind(sqlite3&, sqlite3_stmt&) {}
+        };
+
+        struct GetSchemaVersion
+        {
+            static std::string_view text() noexcept { return "pragma user_version;"; }
+            static void bind(sqlite3&, sqlite3_stmt&) {}
+        };
+
+        std::int64_t getSchemaVersion(sqlite3& db)
+        {
+            Sqlite3::Statement<GetSchemaVersion> statement(db);
+            std::int64_t value = 0;
+            request(db, statement, &value, 1);
+            return value;
+        }
+
+        void exec(sqlite3& db, const char* query, std::string_view description)
+        {
+            if (const int ec = sqlite3_exec(&db, query, nullptr, nullptr, nullptr); ec != SQLITE_OK)
+                throw std::runtime_error("Failed to " + std::string(description) + ": " + sqlite3_errmsg(&db));
+        }
+
+        Sqlite3::Db makeNavMeshDb(std::string_view path)
+        {
+            Sqlite3::Db db = Sqlite3::makeDb(path, schema);
+            const std::int64_t version = getSchemaVersion(*db);
+            if (version > navMeshDbSchemaVersion)
+                throw std::runtime_error("Unsupported navmeshdb schema version: " + std::to_string(version)
+                    + ", expected " + std::to_string(navMeshDbSchemaVersion) + " or lower");
+            if (version < 1)
+            {
+                Sqlite3::Statement<HasTileDataIdColumn> statement(*db);
+                int hasTileDataIdColumn = 0;
+                request(*db, statement, &hasTileDataIdColumn, 1);
+                if (hasTileDataIdColumn == 0)
+                {
+                    Log(Debug::Info) << "Adding tile_data_id column to navmeshdb tiles table";
+                    exec(*db, addTileDataIdColumn, "add tile_data_id column");
+                }
+                Log(Debug::Info) << "Migrating navmeshdb schema to version 1";
+                exec(*db, migrateToVersion1, "migrate navmeshdb schema to version 1");
+            }
+            if (version < 2)
+            {
+                Log(Debug::Info) << "Migrating navmeshdb schema to version 2";
+                exec(*db, migrateToVersion2, "migrate navmeshdb schema to version 2");
+            }
+            return db;
+        }
+
+        std::array<std::uint64_t, 2> getTileDataHash(const std::vector<std::byte>& data)
+        {
+            const std::array<std::uint64_t, 2> seed{ 0, 0 };
+            std::array<std::uint64_t, 2> result{ 0, 0 };
+            MurmurHash3_x64_128(data.data(), static_cast<int>(data.size()), seed.data(), result.data());
+            return result;
+        }
     }
 
     std::ostream& operator<<(std::ostream& stream, ShapeType value)
@@ -167,18 +384,28 @@ namespace DetourNavigator
     }
 
     NavMeshDb::NavMeshDb(std::string_view path, std::uint64_t maxFileSize)
-        : mDb(Sqlite3::makeDb(path, schema))
+        : mDb(makeNavMeshDb(path))
         , mGetMaxTileId(*mDb, DbQueries::GetMaxTileId{})
         , mFindTile(*mDb, DbQueries::FindTile{})
         , mGetTileData(*mDb, DbQueries::GetTileData{})
         , mInsertTile(*mDb, DbQueries::InsertTile{})
         , mUpdateTile(*mDb, DbQueries::UpdateTile{})
         , mDeleteTilesAt(*mDb, DbQueries::DeleteTilesAt{})
+        , mDeleteTiles(*mDb, DbQueries::DeleteTiles{})
         , mDeleteTilesAtExcept(*mDb, DbQueries::DeleteTilesAtExcept{})
         , mDeleteTilesOutsideRange(*mDb, DbQueries::DeleteTilesOutsideRange{})
         , mGetMaxShapeId(*mDb, DbQueries::GetMaxShapeId{})
         , mFindShapeId(*mDb, DbQueries::FindShapeId{})
         , mInsertShape(*mDb, DbQueries::InsertShape{})
+        , mSetTileDataId(*mDb, DbQueries::SetTileDataId{})
+        , mGetTilesWithInlineData(*mDb, DbQueries::GetTilesWithInlineData{})
+        , mFindTileDataId(*mDb, DbQueries::FindTileDataId{})
+        , mInsertTileData(*mDb, DbQueries::InsertTileData{})
+        , mDeleteUnusedTileData(*mDb, DbQueries::DeleteUnusedTileData{})
+        , mGetTileDataStats(*mDb, DbQueries::GetTileDataStats{})
+        , mGetCellFingerprints(*mDb, DbQueries::GetCellFingerprints{})
+        , mSetCellFingerprint(*mDb, DbQueries::SetCellFingerprint{})
+        , mDeleteCellFingerprint(*mDb, DbQueries::DeleteCellFingerprint{})
         , mVacuum(*mDb, DbQueries::Vacuum{})
     {
         const std::uint64_t dbPageSize = getPageSize(*mDb);
@@ -212,13 +439,21 @@ namespace DetourNavigator
 
     std::optional<TileData> NavMeshDb::getTileData(
         std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input)
+    {
+        std::optional<TileData> result = getCompressedTileData(worldspace, tilePosition, input);
+        if (result.has_value())
+            result->mData = Misc::decompress(result->mData);
+        return result;
+    }
+
+    std::optional<TileData> NavMeshDb::getCompressedTileData(
+        std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input)
     {
         TileData result;
         auto row = std::tie(result.mTileId, result.mVersion, result.mData);
         const std::vector<std::byte> compressedInput = Misc::compress(input);
         if (&row == request(*mDb, mGetTileData, &row, 1, worldspace, tilePosition, compressedInput))
             return {};
-        result.mData = Misc::decompress(result.mData);
         return result;
     }
 
@@ -226,14 +461,14 @@ namespace DetourNavigator
         TileVersion version, const std::vector<std::byte>& input, const std::vector<std::byte>& data)
     {
         const std::vector<std::byte> compressedInput = Misc::compress(input);
-        const std::vector<std::byte> compressedData = Misc::compress(data);
-        return execute(*mDb, mInsertTile, tileId, worldspace, tilePosition, version, compressedInput, compressedData);
+        const TileDataId tileDataId = storeTileData(data);
+        return execute(*mDb, mInsertTile, tileId, worldspace, tilePosition, version, compressedInput, tileDataId);
     }
 
     int NavMeshDb::updateTile(TileId tileId, TileVersion version, const std::vector<std::byte>& data)
     {
-        const std::vector<std::byte> compressedData = Misc::compress(data);
-        return execute(*mDb, mUpdateTile, tileId, version, compressedData);
+        const TileDataId tileDataId = storeTileData(data);
+        return execute(*mDb, mUpdateTile, tileId, version, tileDataId);
     }
 
     int NavMeshDb::deleteTilesAt(std::string_view worldspace, const TilePosition& tilePosition)
@@ -241,6 +476,11 @@ namespace DetourNavigator
         return execute(*mDb, mDeleteTilesAt, worldspace, tilePosition);
     }
 
+    int NavMeshDb::deleteTiles(std::string_view worldspace)
+    {
+        return execute(*mDb, mDeleteTiles, worldspace);
+    }
+
     int NavMeshDb::deleteTilesAtExcept(
         std::string_view worldspace, const TilePosition& tilePosition, TileId excludeTileId)
     {
@@ -272,11 +512,66 @@ namespace DetourNavigator
         return execute(*mDb, mInsertShape, shapeId, name, type, hash);
     }
 
+    std::size_t NavMeshDb::migrateTileData(std::size_t limit)
+    {
+        std::vector<std::tuple<TileId, std::vector<std::byte>>> tiles;
+        request(*mDb, mGetTilesWithInlineData, std::back_inserter(tiles), limit, limit);
+        for (const auto& [tileId, compressedData] : tiles)
+            execute(*mDb, mSetTileDataId, tileId, storeTileData(Misc::decompress(compressedData)));
+        return tiles.size();
+    }
+
+    int NavMeshDb::deleteUnusedTileData()
+    {
+        return execute(*mDb, mDeleteUnusedTileData);
+    }
+
+    TileDataStats NavMeshDb::getTileDataStats()
+    {
+        TileDataStats result;
+        auto row = std::tie(result.mTiles, result.mTileData, result.mTileDataSize, result.mFileSize);
+        request(*mDb, mGetTileDataStats, &row, 1);
+        return result;
+    }
+
+    std::vector<CellFingerprint> NavMeshDb::getCellFingerprints()
+    {
+        std::vector<std::tuple<std::string, int, int, std::vector<std::byte>, int, int, int, int>> rows;
+        request(*mDb, mGetCellFingerprints, std::back_inserter(rows), std::numeric_limits<std::size_t>::max());
+        std::vector<CellFingerprint> result;
+        result.reserve(rows.size());
+        for (auto& [worldspace, x, y, hash, beginX, beginY, endX, endY] : rows)
+            result.push_back(CellFingerprint{ std::move(worldspace), osg::Vec2i(x, y), std::move(hash),
+                TilesPositionsRange{ TilePosition(beginX, beginY), TilePosition(endX, endY) } });
+        return result;
+    }
+
+    int NavMeshDb::setCellFingerprint(const CellFingerprint& fingerprint)
+    {
+        return execute(*mDb, mSetCellFingerprint, fingerprint);
+    }
+
+    int NavMeshDb::deleteCellFingerprint(std::string_view worldspace, const osg::Vec2i& cellPosition)
+    {
+        return execute(*mDb, mDeleteCellFingerprint, worldspace, cellPosition);
+    }
+
     void NavMeshDb::vacuum()
     {
         execute(*mDb, mVacuum);
     }
 
+    TileDataId NavMeshDb::storeTileData(const std::vector<std::byte>& data)
+    {
+        const std::array<std::uint64_t, 2> hash = getTileDataHash(data);
+        const Sqlite3::ConstBlob hashBlob{ reinterpret_cast<const char*>(hash.data()), static_cast<int>(sizeof(hash)) };
+        TileDataId tileDataId{ 0 };
+        if (&tileDataId != request(*mDb, mFindTileDataId, &tileDataId, 1, hashBlob))
+            return tileDataId;
+        execute(*mDb, mInsertTileData, hashBlob, Misc::compress(data));
+        return TileDataId{ sqlite3_last_insert_rowid(mDb.get()) };
+    }
+
     namespace DbQueries
     {
         std::string_view GetMaxTileId::text() noexcept
@@ -319,7 +614,7 @@ namespace DetourNavigator
 
         void InsertTile::bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, std::string_view worldspace,
             const TilePosition& tilePosition, TileVersion version, const std::vector<std::byte>& input,
-            const std::vector<std::byte>& data)
+            TileDataId tileDataId)
         {
             Sqlite3::bindParameter(db, statement, ":tile_id", tileId);
             Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
@@ -327,7 +622,7 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":tile_position_y", tilePosition.y());
             Sqlite3::bindParameter(db, statement, ":version", version);
             Sqlite3::bindParameter(db, statement, ":input", input);
-            Sqlite3::bindParameter(db, statement, ":data", data);
+            Sqlite3::bindParameter(db, statement, ":tile_data_id", tileDataId);
         }
 
         std::string_view UpdateTile::text() noexcept
@@ -336,13 +631,66 @@ namespace DetourNavigator
         }
 
         void UpdateTile::bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, TileVersion version,
-            const std::vector<std::byte>& data)
+            TileDataId tileDataId)
         {
             Sqlite3::bindParameter(db, statement, ":tile_id", tileId);
             Sqlite3::bindParameter(db, statement, ":version", version);
+            Sqlite3::bindParameter(db, statement, ":tile_data_id", tileDataId);
+        }
+
+        std::string_view SetTileDataId::text() noexcept
+        {
+            return setTileDataIdQuery;
+        }
+
+        void SetTileDataId::bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, TileDataId tileDataId)
+        {
+            Sqlite3::bindParameter(db, statement, ":tile_id", tileId);
+            Sqlite3::bindParameter(db, statement, ":tile_data_id", tileDataId);
+        }
+
+        std::string_view GetTilesWithInlineData::text() noexcept
+        {
+            return getTilesWithInlineDataQuery;
+        }
+
+        void GetTilesWithInlineData::bind(sqlite3& db, sqlite3_stmt& statement, std::size_t limit)
+        {
+            Sqlite3::bindParameter(db, statement, ":limit", static_cast<std::int64_t>(limit));
+        }
+
+        std::string_view FindTileDataId::text() noexcept
+        {
+            return findTileDataIdQuery;
+        }
+
+        void FindTileDataId::bind(sqlite3& db, sqlite3_stmt& statement, const Sqlite3::ConstBlob& hash)
+        {
+            Sqlite3::bindParameter(db, statement, ":hash", hash);
+        }
+
+        std::string_view InsertTileData::text() noexcept
+        {
+            return insertTileDataQuery;
+        }
+
+        void InsertTileData::bind(
+            sqlite3& db, sqlite3_stmt& statement, const Sqlite3::ConstBlob& hash, const std::vector<std::byte>& data)
+        {
+            Sqlite3::bindParameter(db, statement, ":hash", hash);
             Sqlite3::bindParameter(db, statement, ":data", data);
         }
 
+        std::string_view DeleteUnusedTileData::text() noexcept
+        {
+            return deleteUnusedTileDataQuery;
+        }
+
+        std::string_view GetTileDataStats::text() noexcept
+        {
+            return getTileDataStatsQuery;
+        }
+
         std::string_view DeleteTilesAt::text() noexcept
         {
             return deleteTilesAtQuery;
@@ -356,6 +704,16 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":tile_position_y", tilePosition.y());
         }
 
+        std::string_view DeleteTiles::text() noexcept
+        {
+            return deleteTilesQuery;
+        }
+
+        void DeleteTiles::bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
+        }
+
         std::string_view DeleteTilesAtExcept::text() noexcept
         {
             return deleteTilesAtExceptQuery;
@@ -417,6 +775,41 @@ namespace DetourNavigator
             Sqlite3::bindParameter(db, statement, ":hash", hash);
         }
 
+        std::string_view GetCellFingerprints::text() noexcept
+        {
+            return getCellFingerprintsQuery;
+        }
+
+        std::string_view SetCellFingerprint::text() noexcept
+        {
+            return setCellFingerprintQuery;
+        }
+
+        void SetCellFingerprint::bind(sqlite3& db, sqlite3_stmt& statement, const CellFingerprint& fingerprint)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", fingerprint.mWorldspace);
+            Sqlite3::bindParameter(db, statement, ":cell_position_x", fingerprint.mCellPosition.x());
+            Sqlite3::bindParameter(db, statement, ":cell_position_y", fingerprint.mCellPosition.y());
+            Sqlite3::bindParameter(db, statement, ":hash", fingerprint.mHash);
+            Sqlite3::bindParameter(db, statement, ":tiles_begin_x", fingerprint.mTilesRange.mBegin.x());
+            Sqlite3::bindParameter(db, statement, ":tiles_begin_y", fingerprint.mTilesRange.mBegin.y());
+            Sqlite3::bindParameter(db, statement, ":tiles_end_x", fingerprint.mTilesRange.mEnd.x());
+            Sqlite3::bindParameter(db, statement, ":tiles_end_y", fingerprint.mTilesRange.mEnd.y());
+        }
+
+        std::string_view DeleteCellFingerprint::text() noexcept
+        {
+            return deleteCellFingerprintQuery;
+        }
+
+        void DeleteCellFingerprint::bind(
+            sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const osg::Vec2i& cellPosition)
+        {
+            Sqlite3::bindParameter(db, statement, ":worldspace", worldspace);
+            Sqlite3::bindParameter(db, statement, ":cell_position_x", cellPosition.x());
+            Sqlite3::bindParameter(db, statement, ":cell_position_y", cellPosition.y());
+        }
+
         std::string_view Vacuum::text() noexcept
         {
             return vacuumQuery;
@@ -17,6 +17,7 @@
 #include <memory>
 #include <optional>
 #include <stdexcept>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <utility>
@@ -31,6 +32,10 @@ namespace DetourNavigator
     using TileRevision = Misc::StrongTypedef<std::int64_t, struct TileRevisionTag>;
     using TileVersion = Misc::StrongTypedef<std::int64_t, struct TileVersionTag>;
     using ShapeId = Misc::StrongTypedef<std::int64_t, struct ShapeIdTag>;
+    using TileDataId = Misc::StrongTypedef<std::int64_t, struct TileDataIdTag>;
+
+    // Stored as sqlite user_version. Databases with lower version are migrated on open, higher are rejected.
+    inline constexpr std::int64_t navMeshDbSchemaVersion = 2;
 
     struct Tile
     {
@@ -45,6 +50,24 @@ namespace DetourNavigator
         std::vector<std::byte> mData;
     };
 
+    struct TileDataStats
+    {
+        std::size_t mTiles = 0;
+        std::size_t mTileData = 0;
+        std::size_t mTileDataSize = 0;
+        std::size_t mFileSize = 0;
+    };
+
+    // Hash of everything a cell contributes to the navmesh, allows navmeshtool to process only changed cells.
+    // Tiles range covers all tiles the cell content is rasterized into.
+    struct CellFingerprint
+    {
+        std::string mWorldspace;
+        osg::Vec2i mCellPosition;
+        std::vector<std::byte> mHash;
+        TilesPositionsRange mTilesRange;
+    };
+
     enum class ShapeType
     {
         Collision = 1,
@@ -80,16 +103,53 @@ namespace DetourNavigator
             static std::string_view text() noexcept;
             static void bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, std::string_view worldspace,
                 const TilePosition& tilePosition, TileVersion version, const std::vector<std::byte>& input,
-                const std::vector<std::byte>& data);
+                TileDataId tileDataId);
         };
 
         struct UpdateTile
         {
             static std::string_view text() noexcept;
             static void bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, TileVersion version,
+                TileDataId tileDataId);
+        };
+
+        struct SetTileDataId
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, TileId tileId, TileDataId tileDataId);
+        };
+
+        struct GetTilesWithInlineData
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, std::size_t limit);
+        };
+
+        struct FindTileDataId
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, const Sqlite3::ConstBlob& hash);
+        };
+
+        struct InsertTileData
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, const Sqlite3::ConstBlob& hash,
                 const std::vector<std::byte>& data);
         };
 
+        struct DeleteUnusedTileData
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3&, sqlite3_stmt&) {}
+        };
+
+        struct GetTileDataStats
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3&, sqlite3_stmt&) {}
+        };
+
         struct DeleteTilesAt
         {
             static std::string_view text() noexcept;
@@ -97,6 +157,12 @@ namespace DetourNavigator
                 sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const TilePosition& tilePosition);
         };
 
+        struct DeleteTiles
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace);
+        };
+
         struct DeleteTilesAtExcept
         {
             static std::string_view text() noexcept;
@@ -131,6 +197,25 @@ namespace DetourNavigator
                 ShapeType type, const Sqlite3::ConstBlob& hash);
         };
 
+        struct GetCellFingerprints
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3&, sqlite3_stmt&) {}
+        };
+
+        struct SetCellFingerprint
+        {
+            static std::string_view text() noexcept;
+            static void bind(sqlite3& db, sqlite3_stmt& statement, const CellFingerprint& fingerprint);
+        };
+
+        struct DeleteCellFingerprint
+        {
+            static std::string_view text() noexcept;
+            static void bind(
+                sqlite3& db, sqlite3_stmt& statement, std::string_view worldspace, const osg::Vec2i& cellPosition);
+        };
+
         struct Vacuum
         {
             static std::string_view text() noexcept;
@@ -153,6 +238,12 @@ namespace DetourNavigator
         std::optional<TileData> getTileData(
             std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input);
 
+        // Returns data as it is stored, it has to be passed to Misc::decompress before use. Allows to move
+        // decompression out of the thread accessing the database.
+        std::optional<TileData> getCompressedTileData(
+            std::string_view worldspace, const TilePosition& tilePosition, const std::vector<std::byte>& input);
+
+        // Tiles with the same data share a single tile_data row identified by the data hash.
         int insertTile(TileId tileId, std::string_view worldspace, const TilePosition& tilePosition,
             TileVersion version, const std::vector<std::byte>& input, const std::vector<std::byte>& data);
 
@@ -160,6 +251,8 @@ namespace DetourNavigator
 
         int deleteTilesAt(std::string_view worldspace, const TilePosition& tilePosition);
 
+        int deleteTiles(std::string_view worldspace);
+
         int deleteTilesAtExcept(std::string_view worldspace, const TilePosition& tilePosition, TileId excludeTileId);
 
         int deleteTilesOutsideRange(std::string_view worldspace, const TilesPositionsRange& range);
@@ -170,6 +263,22 @@ namespace DetourNavigator
 
         int insertShape(ShapeId shapeId, std::string_view name, ShapeType type, const Sqlite3::ConstBlob& hash);
 
+        // Moves data of the tiles written by the versions without tile_data table into it. Returns number of the
+        // processed tiles, repeat until it returns zero.
+        std::size_t migrateTileData(std::size_t limit);
+
+        // Unused tile data is deleted together with the last tile referencing it, this is needed only for
+        // databases modified by the versions without such cleanup.
+        int deleteUnusedTileData();
+
+        TileDataStats getTileDataStats();
+
+        std::vector<CellFingerprint> getCellFingerprints();
+
+        int setCellFingerprint(const CellFingerprint& fingerprint);
+
+        int deleteCellFingerprint(std::string_view worldspace, const osg::Vec2i& cellPosition);
+
         void vacuum();
 
     private:
@@ -180,12 +289,24 @@ namespace DetourNavigator
         Sqlite3::Statement<DbQueries::InsertTile> mInsertTile;
         Sqlite3::Statement<DbQueries::UpdateTile> mUpdateTile;
         Sqlite3::Statement<DbQueries::DeleteTilesAt> mDeleteTilesAt;
+        Sqlite3::Statement<DbQueries::DeleteTiles> mDeleteTiles;
         Sqlite3::Statement<DbQueries::DeleteTilesAtExcept> mDeleteTilesAtExcept;
         Sqlite3::Statement<DbQueries::DeleteTilesOutsideRange> mDeleteTilesOutsideRange;
         Sqlite3::Statement<DbQueries::GetMaxShapeId> mGetMaxShapeId;
         Sqlite3::Statement<DbQueries::FindShapeId> mFindShapeId;
         Sqlite3::Statement<DbQueries::InsertShape> mInsertShape;
+        Sqlite3::Statement<DbQueries::SetTileDataId> mSetTileDataId;
+        Sqlite3::Statement<DbQueries::GetTilesWithInlineData> mGetTilesWithInlineData;
+        Sqlite3::Statement<DbQueries::FindTileDataId> mFindTileDataId;
+        Sqlite3::Statement<DbQueries::InsertTileData> mInsertTileData;
+        Sqlite3::Statement<DbQueries::DeleteUnusedTileData> mDeleteUnusedTileData;
+        Sqlite3::Statement<DbQueries::GetTileDataStats> mGetTileDataStats;
+        Sqlite3::Statement<DbQueries::GetCellFingerprints> mGetCellFingerprints;
+        Sqlite3::Statement<DbQueries::SetCellFingerprint> mSetCellFingerprint;
+        Sqlite3::Statement<DbQueries::DeleteCellFingerprint> mDeleteCellFingerprint;
         Sqlite3::Statement<DbQueries::Vacuum> mVacuum;
+
+        TileDataId storeTileData(const std::vector<std::byte>& data);
     };
 }
 
@@ -13,7 +13,9 @@
 
 #include <DetourNavMesh.h>
 
+#include <cmath>
 #include <iterator>
+#include <vector>
 
 namespace
 {
@@ -50,6 +52,27 @@ namespace DetourNavigator
         {
             return getTilePosition(settings, toNavMeshCoordinates(settings, position));
         }
+
+        std::vector<TilePosition> getTilesOnSegment(
+            const RecastSettings& settings, const osg::Vec3f& start, const osg::Vec3f& end)
+        {
+            const osg::Vec3f navMeshStart = toNavMeshCoordinates(settings, start);
+            const osg::Vec3f navMeshEnd = toNavMeshCoordinates(settings, end);
+            const osg::Vec2f delta(navMeshEnd.x() - navMeshStart.x(), navMeshEnd.z() - navMeshStart.z());
+            // Sample twice per tile to not skip tiles crossed near the corner
+            const float step = getTileSize(settings) / 2;
+            const int steps = static_cast<int>(std::ceil(delta.length() / step));
+            std::vector<TilePosition> result;
+            result.push_back(getTilePosition(settings, navMeshStart));
+            for (int i = 1; i <= steps; ++i)
+            {
+                const TilePosition tile = getTilePosition(
+                    settings, navMeshStart + (navMeshEnd - navMeshStart) * (static_cast<float>(i) / steps));
+                if (tile != result.back())
+                    result.push_back(tile);
+            }
+            return result;
+        }
     }
 
     NavMeshManager::NavMeshManager(const Settings& settings, std::unique_ptr<NavMeshDb>&& db)
@@ -203,6 +226,13 @@ namespace DetourNavigator
         mAsyncNavMeshUpdater.wait(waitConditionType, listener);
     }
 
+    void NavMeshManager::prioritizeTiles(const AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end)
+    {
+        if (mCache.find(agentBounds) == mCache.end())
+            return;
+        mAsyncNavMeshUpdater.prioritize(agentBounds, getTilesOnSegment(mSettings.mRecast, start, end));
+    }
+
     SharedNavMeshCacheItem NavMeshManager::getNavMesh(const AgentBounds& agentBounds) const
     {
         return getCached(agentBounds);
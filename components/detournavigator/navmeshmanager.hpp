@@ -57,6 +57,8 @@ namespace DetourNavigator
 
         void wait(WaitConditionType waitConditionType, Loading::Listener* listener);
 
+        void prioritizeTiles(const AgentBounds& agentBounds, const osg::Vec3f& start, const osg::Vec3f& end);
+
         SharedNavMeshCacheItem getNavMesh(const AgentBounds& agentBounds) const;
 
         std::map<AgentBounds, SharedNavMeshCacheItem> getNavMeshes() const;
@@ -0,0 +1,170 @@
+#include "pathqueryservice.hpp"
+#include "findsmoothpath.hpp"
+#include "navigator.hpp"
+#include "navmeshcacheitem.hpp"
+#include "settingsutils.hpp"
+
+#include <components/debug/debuglog.hpp>
+#include <components/misc/thread.hpp>
+
+#include <DetourNavMeshQuery.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+
+namespace DetourNavigator
+{
+    namespace
+    {
+        // Limits how many jobs a worker takes at once to keep others busy when the batch is small
+        constexpr std::size_t maxJobsPerWorker = 16;
+
+        struct NavMeshQuery
+        {
+            std::weak_ptr<GuardedNavMeshCacheItem> mNavMesh;
+            std::unique_ptr<dtNavMeshQuery> mQuery;
+        };
+
+        class NavMeshQueries
+        {
+        public:
+            explicit NavMeshQueries(const DetourSettings& settings)
+                : mSettings(settings)
+            {
+            }
+
+            // Should be called with locked navmesh
+            dtNavMeshQuery* get(const SharedNavMeshCacheItem& navMesh, const NavMeshCacheItem& locked)
+            {
+                auto it = mQueries.find(navMesh.get());
+                if (it != mQueries.end() && it->second.mNavMesh.lock() == navMesh)
+                    return it->second.mQuery.get();
+                auto query = std::make_unique<dtNavMeshQuery>();
+                if (dtStatusFailed(query->init(&locked.getImpl(), mSettings.mMaxNavMeshQueryNodes)))
+                    return nullptr;
+                NavMeshQuery& value = mQueries[navMesh.get()];
+                value.mNavMesh = navMesh;
+                value.mQuery = std::move(query);
+                return value.mQuery.get();
+            }
+
+            void removeExpired()
+            {
+                std::erase_if(mQueries, [](const auto& v) { return v.second.mNavMesh.expired(); });
+            }
+
+        private:
+            const DetourSettings& mSettings;
+            std::map<const GuardedNavMeshCacheItem*, NavMeshQuery> mQueries;
+        };
+
+        PathQueryResult runQuery(const Settings& settings, const SharedNavMeshCacheItem& navMesh,
+            NavMeshQueries& queries, const PathQuery& query)
+        {
+            PathQueryResult result;
+            auto out = std::back_inserter(result.mPath);
+            auto outTransform = withFromNavMeshCoordinates(out, settings.mRecast);
+            const auto locked = navMesh->lock();
+            dtNavMeshQuery* const navMeshQuery = queries.get(navMesh, *locked);
+            if (navMeshQuery == nullptr)
+            {
+                result.mStatus = Status::InitNavMeshQueryFailed;
+                return result;
+            }
+            result.mStatus = findSmoothPath(*navMeshQuery,
+                toNavMeshCoordinates(settings.mRecast, query.mAgentBounds.mHalfExtents),
+                toNavMeshCoordinates(settings.mRecast, query.mStart),
+                toNavMeshCoordinates(settings.mRecast, query.mEnd), query.mIncludeFlags, query.mAreaCosts,
+                settings.mDetour, query.mEndTolerance, outTransform);
+            return result;
+        }
+    }
+
+    PathQueryService::PathQueryService(const Navigator& navigator, std::size_t threads)
+        : mNavigator(navigator)
+        , mSettings(navigator.getSettings())
+    {
+        for (std::size_t i = 0; i < threads; ++i)
+            mThreads.emplace_back([&] { process(); });
+    }
+
+    PathQueryService::~PathQueryService()
+    {
+        stop();
+    }
+
+    std::future<PathQueryResult> PathQueryService::post(const PathQuery& query)
+    {
+        std::promise<PathQueryResult> promise;
+        std::future<PathQueryResult> result = promise.get_future();
+        SharedNavMeshCacheItem navMesh = mNavigator.getNavMesh(query.mAgentBounds);
+        if (navMesh == nullptr)
+        {
+            promise.set_value(PathQueryResult{ .mStatus = Status::NavMeshNotFound, .mPath = {} });
+            return result;
+        }
+        const std::lock_guard<std::mutex> lock(mMutex);
+        if (mShouldStop)
+            return result;
+        mJobs.push_back(Job{ .mNavMesh = std::move(navMesh), .mQuery = query, .mResult = std::move(promise) });
+        mHasJob.notify_one();
+        return result;
+    }
+
+    void PathQueryService::stop()
+    {
+        mShouldStop = true;
+        std::unique_lock<std::mutex> lock(mMutex);
+        mJobs.clear();
+        mHasJob.notify_all();
+        lock.unlock();
+        for (auto& thread : mThreads)
+            if (thread.joinable())
+                thread.join();
+    }
+
+    void PathQueryService::process() noexcept
+    {
+        Log(Debug::Debug) << "Start process path queries by thread=" << std::this_thread::get_id();
+        Misc::setCurrentThreadIdlePriority();
+        NavMeshQueries queries(mSettings.mDetour);
+        std::vector<Job> jobs;
+        while (!mShouldStop)
+        {
+            try
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    mHasJob.wait(lock, [&] { return mShouldStop || !mJobs.empty(); });
+                    const std::size_t count = std::min(mJobs.size(), maxJobsPerWorker);
+                    std::move(mJobs.begin(), mJobs.begin() + count, std::back_inserter(jobs));
+                    mJobs.erase(mJobs.begin(), mJobs.begin() + count);
+                }
+                // Group by navmesh to reuse the same query and keep its node pool warm
+                std::stable_sort(jobs.begin(), jobs.end(),
+                    [](const Job& lhs, const Job& rhs) { return lhs.mNavMesh < rhs.mNavMesh; });
+                for (Job& job : jobs)
+                {
+                    try
+                    {
+                        job.mResult.set_value(runQuery(mSettings, job.mNavMesh, queries, job.mQuery));
+                    }
+                    catch (...)
+                    {
+                        job.mResult.set_exception(std::current_exception());
+                    }
+                }
+                jobs.clear();
+                queries.removeExpired();
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "PathQueryService::process exception: " << e.what();
+                jobs.clear();
+            }
+        }
+        Log(Debug::Debug) << "Stop path queries process by thread=" << std::this_thread::get_id();
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHQUERYSERVICE_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_PATHQUERYSERVICE_H
+
+#include "agentbounds.hpp"
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "settings.hpp"
+#include "sharednavmeshcacheitem.hpp"
+#include "status.hpp"
+
+#include <osg/Vec3f>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DetourNavigator
+{
+    class Navigator;
+
+    struct PathQuery
+    {
+        AgentBounds mAgentBounds;
+        osg::Vec3f mStart;
+        osg::Vec3f mEnd;
+        Flags mIncludeFlags = Flag_none;
+        AreaCosts mAreaCosts;
+        float mEndTolerance = 0;
+    };
+
+    struct PathQueryResult
+    {
+        Status mStatus = Status::Success;
+        std::vector<osg::Vec3f> mPath;
+    };
+
+    /**
+     * @brief PathQueryService finds paths over navmesh on a set of worker threads.
+     * Each worker owns its own dtNavMeshQuery per navmesh so queries don't share the one stored in the navmesh cache
+     * item and the navmesh lock is held only for a single query. Navmeshes are resolved on the posting thread because
+     * Navigator::getNavMesh is not thread safe, so post may be called only from the thread that updates navigator.
+     */
+    class PathQueryService
+    {
+    public:
+        explicit PathQueryService(const Navigator& navigator, std::size_t threads);
+
+        ~PathQueryService();
+
+        std::future<PathQueryResult> post(const PathQuery& query);
+
+        void stop();
+
+    private:
+        struct Job
+        {
+            SharedNavMeshCacheItem mNavMesh;
+            PathQuery mQuery;
+            std::promise<PathQueryResult> mResult;
+        };
+
+        const Navigator& mNavigator;
+        const Settings mSettings;
+        std::mutex mMutex;
+        std::condition_variable mHasJob;
+        std::deque<Job> mJobs;
+        std::atomic_bool mShouldStop{ false };
+        std::vector<std::thread> mThreads;
+
+        void process() noexcept;
+    };
+}
+
+#endif
@@ -149,6 +149,15 @@ namespace DetourNavigator
                 visitor(*this, dbRefGeometryObjects);
             }
 
+            template <class Visitor>
+            void operator()(Visitor&& visitor, const RecastSettings& settings, const AgentBounds& agentBounds) const
+            {
+                visitor(*this, DetourNavigator::recastMeshMagic);
+                visitor(*this, DetourNavigator::recastMeshVersion);
+                visitor(*this, settings);
+                visitor(*this, agentBounds);
+            }
+
             template <class Visitor, class T>
             auto operator()(Visitor&& visitor, T& value) const
                 -> std::enable_if_t<std::is_same_v<std::decay_t<T>, rcPolyMesh>>
@@ -256,6 +265,16 @@ namespace DetourNavigator
         return result;
     }
 
+    std::vector<std::byte> serialize(const RecastSettings& settings, const AgentBounds& agentBounds)
+    {
+        constexpr Format<Serialization::Mode::Write> format;
+        Serialization::SizeAccumulator sizeAccumulator;
+        format(sizeAccumulator, settings, agentBounds);
+        std::vector<std::byte> result(sizeAccumulator.value());
+        format(Serialization::BinaryWriter(result.data(), result.data() + result.size()), settings, agentBounds);
+        return result;
+    }
+
     std::vector<std::byte> serialize(const PreparedNavMeshData& value)
     {
         constexpr Format<Serialization::Mode::Write> format;
@@ -2,10 +2,23 @@
 
 #include <osg/Stats>
 
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <string_view>
+
 namespace DetourNavigator
 {
     namespace
     {
+        void reportLatency(
+            const LatencyHistogram& histogram, std::string_view name, unsigned int frameNumber, osg::Stats& out)
+        {
+            if (const auto value = histogram.getQuantileUpperBound(0.9))
+                out.setAttribute(frameNumber, std::string(name), static_cast<double>(*value));
+        }
+
         void reportStats(const AsyncNavMeshUpdaterStats& stats, unsigned int frameNumber, osg::Stats& out)
         {
             out.setAttribute(frameNumber, "NavMesh Jobs", static_cast<double>(stats.mJobs));
@@ -29,7 +42,40 @@ namespace DetourNavigator
             out.setAttribute(frameNumber, "NavMesh CachedTiles", static_cast<double>(stats.mCache.mCachedNavMeshTiles));
             out.setAttribute(frameNumber, "NavMesh Cache Get", static_cast<double>(stats.mCache.mGetCount));
             out.setAttribute(frameNumber, "NavMesh Cache Hit", static_cast<double>(stats.mCache.mHitCount));
+
+            reportLatency(stats.mLatency.mRequired, "NavMesh Latency Req", frameNumber, out);
+            reportLatency(stats.mLatency.mRegular, "NavMesh Latency Reg", frameNumber, out);
+        }
+    }
+
+    void LatencyHistogram::add(std::chrono::steady_clock::duration value)
+    {
+        const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(value).count();
+        std::size_t bucket = 0;
+        while (bucket + 1 < sSize && (std::int64_t{ 1 } << bucket) <= milliseconds)
+            ++bucket;
+        ++mBuckets[bucket];
+    }
+
+    std::size_t LatencyHistogram::getCount() const
+    {
+        return std::accumulate(mBuckets.begin(), mBuckets.end(), std::size_t{ 0 });
+    }
+
+    std::optional<std::size_t> LatencyHistogram::getQuantileUpperBound(double quantile) const
+    {
+        const std::size_t count = getCount();
+        if (count == 0)
+            return std::nullopt;
+        const auto threshold = static_cast<std::size_t>(std::ceil(quantile * static_cast<double>(count)));
+        std::size_t accumulated = 0;
+        for (std::size_t i = 0; i < sSize; ++i)
+        {
+            accumulated += mBuckets[i];
+            if (accumulated >= threshold)
+                return std::size_t{ 1 } << i;
         }
+        return std::size_t{ 1 } << (sSize - 1);
     }
 
     void reportStats(const Stats& stats, unsigned int frameNumber, osg::Stats& out)
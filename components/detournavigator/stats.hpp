@@ -1,6 +1,8 @@
 #ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_STATS_H
 #define OPENMW_COMPONENTS_DETOURNAVIGATOR_STATS_H
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <optional>
 
@@ -32,6 +34,28 @@ namespace DetourNavigator
         std::size_t mGetCount = 0;
     };
 
+    struct LatencyHistogram
+    {
+        // Bucket i counts values below 2^i milliseconds, the last one counts everything else
+        static constexpr std::size_t sSize = 12;
+
+        std::array<std::size_t, sSize> mBuckets{};
+
+        void add(std::chrono::steady_clock::duration value);
+
+        std::size_t getCount() const;
+
+        // Upper bound of the bucket containing given quantile in milliseconds
+        std::optional<std::size_t> getQuantileUpperBound(double quantile) const;
+    };
+
+    struct JobsLatencyStats
+    {
+        // Jobs for tiles required to find a path
+        LatencyHistogram mRequired;
+        LatencyHistogram mRegular;
+    };
+
     struct AsyncNavMeshUpdaterStats
     {
         std::size_t mJobs = 0;
@@ -41,6 +65,7 @@ namespace DetourNavigator
         std::size_t mDbGetTileHits = 0;
         std::optional<DbWorkerStats> mDb;
         NavMeshTilesCacheStats mCache;
+        JobsLatencyStats mLatency;
     };
 
     struct Stats
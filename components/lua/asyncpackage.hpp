@@ -32,7 +32,10 @@ namespace LuaUtil
         {
             sol::optional<ScriptId> scriptId = mHiddenData[ScriptsContainer::sScriptIdKey];
             if (scriptId.has_value())
+            {
+                LuaState::HandlerScope scope(mFunc.lua_state(), scriptId.value(), "callback");
                 return LuaUtil::call(scriptId.value(), mFunc, std::forward<Args>(args)...);
+            }
             else
                 Log(Debug::Debug) << "Ignored callback to the removed script "
                                   << mHiddenData.get<std::string>(ScriptsContainer::sScriptDebugNameKey);
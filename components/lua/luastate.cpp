@@ -4,12 +4,18 @@
 #include <luajit.h>
 #endif // NO_LUAJIT
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
 
 #include <components/debug/debuglog.hpp>
 #include <components/files/conversion.hpp>
+#include <components/files/hash.hpp>
 #include <components/vfs/manager.hpp>
+#include <components/vfs/pathutil.hpp>
 
 #include "scriptscontainer.hpp"
 #include "utf8.hpp"
@@ -66,6 +72,8 @@ namespace LuaUtil
             return;
         const ScriptId& activeScript = self->mActiveScriptIdStack.back();
         activeScript.mContainer->addInstructionCount(activeScript.mIndex, countHookStep);
+        if (self->mSamplingEnabled)
+            self->sampleStack(L);
         self->mWatchdogInstructionCounter += countHookStep;
         if (self->mSettings.mInstructionLimit > 0
             && self->mWatchdogInstructionCounter > self->mSettings.mInstructionLimit)
@@ -77,6 +85,111 @@ namespace LuaUtil
         }
     }
 
+    void LuaState::sampleStack(lua_State* L)
+    {
+        constexpr int maxDepth = 32;
+
+        std::string& stack = mSampledStackBuffer;
+        stack.clear();
+        if (mActiveHandlerStack.empty())
+        {
+            appendScriptName(stack, mActiveScriptIdStack.back());
+            stack += ";?";
+        }
+        else
+            stack += mActiveHandlerStack.back();
+
+        lua_Debug ar;
+        int depth = 0;
+        while (depth < maxDepth && lua_getstack(L, depth, &ar))
+            ++depth;
+        for (int level = depth - 1; level >= 0; --level)
+        {
+            if (!lua_getstack(L, level, &ar) || !lua_getinfo(L, "Sn", &ar))
+                continue;
+            stack += ';';
+            stack += ar.short_src;
+            stack += ':';
+            stack += std::to_string(ar.linedefined);
+            if (ar.name != nullptr)
+            {
+                stack += ' ';
+                stack += ar.name;
+            }
+        }
+
+        auto it = mSampledStacks.find(stack);
+        if (it == mSampledStacks.end())
+            mSampledStacks.emplace(stack, 1);
+        else
+            ++it->second;
+    }
+
+    void LuaState::appendScriptName(std::string& out, const ScriptId& scriptId)
+    {
+        out += scriptId.mContainer->mNamePrefix;
+        out += '[';
+        out += scriptId.mContainer->scriptPath(scriptId.mIndex);
+        out += ']';
+    }
+
+    static constexpr double handlerTimeAvgCoef = 1.0 / 30; // averaging over approximately 30 frames
+
+    void LuaState::samplingNextFrame()
+    {
+        for (auto& [name, time] : mHandlerTimes)
+        {
+            time.mAverage = time.mAverage * (1 - handlerTimeAvgCoef) + time.mCurrentFrame * handlerTimeAvgCoef;
+            time.mCurrentFrame = 0;
+        }
+    }
+
+    std::vector<std::pair<std::string, double>> LuaState::getHandlerTimes() const
+    {
+        std::vector<std::pair<std::string, double>> result;
+        result.reserve(mHandlerTimes.size());
+        for (const auto& [name, time] : mHandlerTimes)
+            result.emplace_back(name, time.mAverage);
+        std::sort(result.begin(), result.end(), [](const auto& l, const auto& r) { return l.second > r.second; });
+        return result;
+    }
+
+    void LuaState::writeSampledStacks(std::ostream& stream) const
+    {
+        for (const auto& [stack, count] : mSampledStacks)
+            stream << stack << ' ' << count << '\n';
+    }
+
+    LuaState::HandlerScope::HandlerScope(lua_State* L, ScriptId scriptId, std::string_view handlerName)
+    {
+        if (!sProfilerEnabled || scriptId.mContainer == nullptr)
+            return;
+        LuaState* lua;
+        (void)lua_getallocf(L, reinterpret_cast<void**>(&lua));
+        if (!lua->mSamplingEnabled)
+            return;
+        mLua = lua;
+        std::string name;
+        appendScriptName(name, scriptId);
+        name += ';';
+        name += handlerName;
+        mLua->mActiveHandlerStack.push_back(std::move(name));
+        mStart = std::chrono::steady_clock::now();
+    }
+
+    LuaState::HandlerScope::~HandlerScope()
+    {
+        if (mLua == nullptr)
+            return;
+        const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - mStart;
+        const std::string& name = mLua->mActiveHandlerStack.back();
+        auto it = mLua->mHandlerTimes.find(name);
+        if (it == mLua->mHandlerTimes.end())
+            it = mLua->mHandlerTimes.emplace(name, HandlerTime{}).first;
+        it->second.mCurrentFrame += duration.count();
+        mLua->mActiveHandlerStack.pop_back();
+    }
+
     void* LuaState::trackingAllocator(void* ud, void* ptr, size_t osize, size_t nsize)
     {
         LuaState* self = static_cast<LuaState*>(ud);
@@ -383,11 +496,142 @@ namespace LuaUtil
         auto iter = mCompiledScripts.find(path);
         if (iter != mCompiledScripts.end())
             return mSol.load(iter->second.as_string_view(), path, sol::load_mode::binary);
+        if (!mSettings.mBytecodeCachePath.empty())
+            return loadWithBytecodeCache(path);
         sol::function res = loadFromVFS(path);
         mCompiledScripts[path] = res.dump();
         return res;
     }
 
+    static constexpr std::string_view bytecodeCacheFileExtension = ".luac";
+
+    static std::string getHashString(const std::string& name, std::string_view value)
+    {
+        std::istringstream stream{ std::string(value) };
+        const std::array<std::uint64_t, 2> hash = Files::getHash(name, stream);
+        std::ostringstream result;
+        result << std::hex << std::setfill('0') << std::setw(16) << hash[0] << std::setw(16) << hash[1];
+        return result.str();
+    }
+
+    static std::filesystem::path getBytecodeCacheFilePath(
+        const std::filesystem::path& cachePath, const std::string& path)
+    {
+        const std::string normalizedPath = VFS::Path::normalizeFilename(path);
+        return cachePath / (getHashString(normalizedPath, normalizedPath) + std::string(bytecodeCacheFileExtension));
+    }
+
+    static void writeBytecodeCacheFile(
+        const std::filesystem::path& filePath, std::string_view header, std::string_view bytecode)
+    {
+        try
+        {
+            std::filesystem::create_directories(filePath.parent_path());
+            // Write to a temporary file first so an interrupted write never leaves a truncated cache file
+            std::filesystem::path tmpPath = filePath;
+            tmpPath += ".tmp";
+            {
+                std::ofstream stream(tmpPath, std::ios::binary);
+                stream.exceptions(std::ios::failbit | std::ios::badbit);
+                stream << header << bytecode;
+            }
+            std::filesystem::rename(tmpPath, filePath);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to write Lua bytecode cache file " << Files::pathToUnicodeString(filePath)
+                                << ": " << e.what();
+        }
+    }
+
+    sol::function LuaState::loadWithBytecodeCache(const std::string& path)
+    {
+        const Files::IStreamPtr stream = mVFS->get(path);
+        const std::array<std::uint64_t, 2> sourceHash = Files::getHash(path, *stream);
+        // Bytecode is valid only for the same source and the same Lua implementation. The header ends with
+        // a checksum of the bytecode to detect corrupted files.
+        const std::string header = getLuaVersion() + '\n' + std::to_string(sourceHash[0]) + ' '
+            + std::to_string(sourceHash[1]) + '\n';
+        const std::filesystem::path cacheFilePath = getBytecodeCacheFilePath(mSettings.mBytecodeCachePath, path);
+
+        std::ifstream cacheFile(cacheFilePath, std::ios::binary);
+        if (cacheFile)
+        {
+            const std::string cached(std::istreambuf_iterator<char>(cacheFile), {});
+            cacheFile.close();
+            if (cached.starts_with(header))
+            {
+                const std::string_view checksumAndBytecode = std::string_view(cached).substr(header.size());
+                const std::size_t checksumEnd = checksumAndBytecode.find('\n');
+                if (checksumEnd != std::string_view::npos)
+                {
+                    const std::string_view bytecode = checksumAndBytecode.substr(checksumEnd + 1);
+                    if (checksumAndBytecode.substr(0, checksumEnd) == getHashString(path, bytecode))
+                    {
+                        sol::load_result res = mSol.load(bytecode, path, sol::load_mode::binary);
+                        if (res.valid())
+                        {
+                            sol::function fn = res;
+                            mCompiledScripts[path] = fn.dump();
+                            ++mBytecodeCacheHits;
+                            return fn;
+                        }
+                    }
+                }
+            }
+            // Source has changed or the file is damaged, don't keep it if the script fails to compile
+            Log(Debug::Verbose) << "Removing outdated Lua bytecode cache file "
+                                << Files::pathToUnicodeString(cacheFilePath) << " for " << path;
+            std::error_code ec;
+            std::filesystem::remove(cacheFilePath, ec);
+        }
+
+        const std::string fileContent(std::istreambuf_iterator<char>(*stream), {});
+        sol::load_result res = mSol.load(fileContent, path, sol::load_mode::text);
+        if (!res.valid())
+            throw std::runtime_error("Lua error: " + res.get<std::string>());
+        sol::function fn = res;
+        sol::bytecode bytecode = fn.dump();
+        writeBytecodeCacheFile(cacheFilePath, header + getHashString(path, bytecode.as_string_view()) + '\n',
+            bytecode.as_string_view());
+        mCompiledScripts[path] = std::move(bytecode);
+        return fn;
+    }
+
+    void LuaState::removeStaleBytecodeCacheFiles() const
+    {
+        const std::filesystem::path& cachePath = mSettings.mBytecodeCachePath;
+        if (cachePath.empty() || !std::filesystem::is_directory(cachePath))
+            return;
+
+        std::set<std::filesystem::path> used;
+        for (const std::string& file : mVFS->getRecursiveDirectoryIterator(""))
+            if (file.ends_with(".lua"))
+                used.insert(getBytecodeCacheFilePath(cachePath, file));
+
+        std::size_t removed = 0;
+        try
+        {
+            for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(cachePath))
+            {
+                // Also removes temporary files left by interrupted writes
+                if (entry.path().extension() == ".tmp"
+                    || (entry.path().extension() == bytecodeCacheFileExtension && !used.contains(entry.path())))
+                {
+                    std::filesystem::remove(entry.path());
+                    ++removed;
+                }
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to remove stale Lua bytecode cache files from "
+                                << Files::pathToUnicodeString(cachePath) << ": " << e.what();
+        }
+        if (removed > 0)
+            Log(Debug::Verbose) << "Removed " << removed << " stale Lua bytecode cache files";
+    }
+
     sol::function LuaState::loadFromVFS(const std::string& path)
     {
         std::string fileContent(std::istreambuf_iterator<char>(*mVFS->get(path)), {});
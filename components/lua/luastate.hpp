@@ -1,9 +1,14 @@
 #ifndef COMPONENTS_LUA_LUASTATE_H
 #define COMPONENTS_LUA_LUASTATE_H
 
+#include <chrono>
 #include <filesystem>
+#include <iosfwd>
 #include <map>
+#include <string_view>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include <sol/sol.hpp>
 
@@ -32,6 +37,7 @@ namespace LuaUtil
         uint64_t mMemoryLimit = 0; // 0 is unlimited
         uint64_t mSmallAllocMaxSize = 1024 * 1024; // big default value efficiently disables memory tracking
         bool mLogMemoryUsage = false;
+        std::filesystem::path mBytecodeCachePath; // empty disables the persistent bytecode cache
     };
 
     // Holds Lua state.
@@ -112,10 +118,46 @@ namespace LuaUtil
 
         const LuaStateSettings& getSettings() const { return mSettings; }
 
+        // Removes persistent bytecode cache files of scripts that are not present in the VFS anymore.
+        void removeStaleBytecodeCacheFiles() const;
+        // Number of scripts loaded from the persistent bytecode cache
+        std::size_t getBytecodeCacheHits() const { return mBytecodeCacheHits; }
+
         // Note: Lua profiler can not be re-enabled after disabling.
         static void disableProfiler() { sProfilerEnabled = false; }
         static bool isProfilerEnabled() { return sProfilerEnabled; }
 
+        // Sampling profiler. Works only together with the Lua profiler: every time the instruction count hook fires,
+        // the Lua call stack is recorded and attributed to the script and the handler that is being executed.
+        // Also measures time spent in every handler.
+        void setSamplingEnabled(bool value) { mSamplingEnabled = value && sProfilerEnabled; }
+        bool isSamplingEnabled() const { return mSamplingEnabled; }
+
+        // Should be called once per frame to average the time spent in handlers.
+        void samplingNextFrame();
+
+        // Returns "<script>;<handler>" and the average time per frame in milliseconds, the most expensive first.
+        std::vector<std::pair<std::string, double>> getHandlerTimes() const;
+
+        // Writes sampled stacks in the folded format (one "frame1;frame2;...;frameN count" line per stack)
+        // that is accepted by flamegraph tools.
+        void writeSampledStacks(std::ostream& stream) const;
+
+        // Marks execution of a handler of a script for the sampling profiler.
+        class HandlerScope
+        {
+        public:
+            HandlerScope(lua_State* L, ScriptId scriptId, std::string_view handlerName);
+            ~HandlerScope();
+
+            HandlerScope(const HandlerScope&) = delete;
+            HandlerScope& operator=(const HandlerScope&) = delete;
+
+        private:
+            LuaState* mLua = nullptr; // null if sampling is disabled
+            std::chrono::steady_clock::time_point mStart;
+        };
+
     private:
         static sol::protected_function_result throwIfError(sol::protected_function_result&&);
         template <typename... Args>
@@ -125,7 +167,10 @@ namespace LuaUtil
             ScriptId scriptId, const sol::protected_function& fn, Args&&... args);
 
         sol::function loadScriptAndCache(const std::string& path);
+        sol::function loadWithBytecodeCache(const std::string& path);
         static void countHook(lua_State* L, lua_Debug* ar);
+        void sampleStack(lua_State* L);
+        static void appendScriptName(std::string& out, const ScriptId& scriptId);
         static void* trackingAllocator(void* ud, void* ptr, size_t osize, size_t nsize);
 
         lua_State* createLuaRuntime(LuaState* luaState);
@@ -146,6 +191,18 @@ namespace LuaUtil
         uint64_t mSmallAllocMemoryUsage = 0;
         std::vector<int64_t> mMemoryUsage;
 
+        struct HandlerTime
+        {
+            double mCurrentFrame = 0;
+            double mAverage = 0;
+        };
+
+        bool mSamplingEnabled = false;
+        std::vector<std::string> mActiveHandlerStack; // "<script>;<handler>"
+        std::map<std::string, HandlerTime, std::less<>> mHandlerTimes;
+        std::map<std::string, int64_t, std::less<>> mSampledStacks;
+        std::string mSampledStackBuffer;
+
         class LuaStateHolder
         {
         public:
@@ -170,6 +227,7 @@ namespace LuaUtil
         const ScriptsConfiguration* mConf;
         sol::table mSandboxEnv;
         std::map<std::string, sol::bytecode> mCompiledScripts;
+        std::size_t mBytecodeCacheHits = 0;
         std::map<std::string, sol::object> mCommonPackages;
         const VFS::Manager* mVFS;
         std::vector<std::filesystem::path> mLibSearchPaths;
@@ -209,6 +209,7 @@ namespace LuaUtil
         {
             try
             {
+                LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, scriptId }, "onInterfaceOverride");
                 LuaUtil::call({ this, scriptId }, *script.mOnOverride, *prev->mInterface);
             }
             catch (std::exception& e)
@@ -220,6 +221,7 @@ namespace LuaUtil
         {
             try
             {
+                LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, nextId }, "onInterfaceOverride");
                 LuaUtil::call({ this, nextId }, *next->mOnOverride, *script.mInterface);
             }
             catch (std::exception& e)
@@ -259,6 +261,7 @@ namespace LuaUtil
                     prevInterface = *prev->mInterface;
                 try
                 {
+                    LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, nextId }, "onInterfaceOverride");
                     LuaUtil::call({ this, nextId }, *next->mOnOverride, prevInterface);
                 }
                 catch (std::exception& e)
@@ -314,6 +317,7 @@ namespace LuaUtil
             const Handler& h = list[i];
             try
             {
+                LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, h.mScriptId }, eventName);
                 sol::object res = LuaUtil::call({ this, h.mScriptId }, h.mFn, data);
                 if (res.is<bool>() && !res.as<bool>())
                     break; // Skip other handlers if 'false' was returned.
@@ -336,6 +340,7 @@ namespace LuaUtil
     {
         try
         {
+            LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, scriptId }, "onInit");
             LuaUtil::call({ this, scriptId }, onInit, deserialize(mLua.sol(), data, mSerializer));
         }
         catch (std::exception& e)
@@ -372,6 +377,7 @@ namespace LuaUtil
             {
                 try
                 {
+                    LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, scriptId }, "onSave");
                     sol::object state = LuaUtil::call({ this, scriptId }, *script.mOnSave);
                     savedScript.mData = serialize(state, mSerializer);
                 }
@@ -435,6 +441,7 @@ namespace LuaUtil
                 {
                     sol::object state = deserialize(mLua.sol(), scriptInfo.mSavedData->mData, mSavedDataDeserializer);
                     sol::object initializationData = deserialize(mLua.sol(), scriptInfo.mInitData, mSerializer);
+                    LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, scriptId }, "onLoad");
                     LuaUtil::call({ this, scriptId }, *onLoad, state, initializationData);
                 }
                 catch (std::exception& e)
@@ -552,6 +559,7 @@ namespace LuaUtil
     {
         try
         {
+            LuaState::HandlerScope scope(mLua.sol().lua_state(), { this, t.mScriptId }, "timer");
             Script& script = getScript(t.mScriptId);
             if (t.mSerializable)
             {
@@ -576,12 +584,19 @@ namespace LuaUtil
 
     void ScriptsContainer::updateTimerQueue(std::vector<Timer>& timerQueue, double time)
     {
+        // Due timers are taken out of the heap before calling any of them: callbacks can set up new timers, which
+        // would otherwise invalidate the front reference and could be popped instead of the timer that was called.
+        // Timers set up by the callbacks are processed on the next call.
+        mDueTimers.clear();
         while (!timerQueue.empty() && timerQueue.front().mTime <= time)
         {
-            callTimer(timerQueue.front());
             std::pop_heap(timerQueue.begin(), timerQueue.end());
+            mDueTimers.push_back(std::move(timerQueue.back()));
             timerQueue.pop_back();
         }
+        for (const Timer& timer : mDueTimers)
+            callTimer(timer);
+        mDueTimers.clear();
     }
 
     void ScriptsContainer::processTimers(double simulationTime, double gameTime)
@@ -184,6 +184,8 @@ namespace LuaUtil
             {
                 try
                 {
+                    LuaState::HandlerScope scope(
+                        mLua.sol().lua_state(), { this, handler.mScriptId }, handlers.mName);
                     LuaUtil::call({ this, handler.mScriptId }, handler.mFn, args...);
                 }
                 catch (std::exception& e)
@@ -262,6 +264,7 @@ namespace LuaUtil
 
         std::vector<Timer> mSimulationTimersQueue;
         std::vector<Timer> mGameTimersQueue;
+        std::vector<Timer> mDueTimers; // reused by updateTimerQueue
         int64_t mTemporaryCallbackCounter = 0;
 
         std::map<int, int64_t> mRemovedScriptsMemoryUsage;
@@ -381,4 +381,27 @@ namespace LuaUtil
         return sol::stack::pop<sol::object>(lua);
     }
 
+    SerializedTableBuilder::SerializedTableBuilder()
+    {
+        mData.push_back(FORMAT_VERSION);
+        appendType(mData, SerializedType::TABLE_START);
+    }
+
+    void SerializedTableBuilder::add(std::string_view key, std::string_view serializedValue)
+    {
+        if (serializedValue.empty())
+            return;
+        if (serializedValue[0] != FORMAT_VERSION)
+            throw std::runtime_error("Incorrect version of Lua serialization format: "
+                + std::to_string(static_cast<unsigned>(serializedValue[0])));
+        appendString(mData, key);
+        mData.append(serializedValue.substr(1));
+    }
+
+    BinaryData SerializedTableBuilder::finish() &&
+    {
+        appendType(mData, SerializedType::TABLE_END);
+        return std::move(mData);
+    }
+
 }
@@ -54,6 +54,23 @@ namespace LuaUtil
     sol::object deserialize(lua_State* lua, std::string_view binaryData,
         const UserdataSerializer* customSerializer = nullptr, bool readOnly = false);
 
+    // Composes serialized data of a table with string keys from already serialized values without using Lua,
+    // so it can be used for data that is stored in the serialized form. The result can be read by `deserialize`.
+    class SerializedTableBuilder
+    {
+    public:
+        SerializedTableBuilder();
+
+        // `serializedValue` should be a result of `serialize` or `SerializedTableBuilder::finish`.
+        // Empty value means nil and is skipped.
+        void add(std::string_view key, std::string_view serializedValue);
+
+        BinaryData finish() &&;
+
+    private:
+        BinaryData mData;
+    };
+
 }
 
 #endif // COMPONENTS_LUA_SERIALIZATION_H
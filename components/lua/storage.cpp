@@ -65,6 +65,7 @@ namespace LuaUtil
     void LuaStorage::Section::set(std::string_view key, const sol::object& value)
     {
         throwIfCallbackRecursionIsTooDeep();
+        mSerializedValid = false;
         if (value != sol::nil)
             mValues[std::string(key)] = Value(value);
         else
@@ -81,6 +82,7 @@ namespace LuaUtil
     void LuaStorage::Section::setAll(const sol::optional<sol::table>& values)
     {
         throwIfCallbackRecursionIsTooDeep();
+        mSerializedValid = false;
         mValues.clear();
         if (values)
         {
@@ -100,6 +102,19 @@ namespace LuaUtil
         return res;
     }
 
+    const BinaryData& LuaStorage::Section::getSerialized() const
+    {
+        if (!mSerializedValid)
+        {
+            SerializedTableBuilder builder;
+            for (const auto& [k, v] : mValues)
+                builder.add(k, v.getSerialized());
+            mSerialized = std::move(builder).finish();
+            mSerializedValid = true;
+        }
+        return mSerialized;
+    }
+
     void LuaStorage::initLuaBindings(lua_State* L)
     {
         sol::state_view lua(L);
@@ -191,33 +206,69 @@ namespace LuaUtil
                              << " bytes)";
             std::ifstream fin(path, std::fstream::binary);
             std::string serializedData((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
-            sol::table data = deserialize(mLua, serializedData);
-            for (const auto& [sectionName, sectionTable] : data)
+            sol::object data = deserialize(mLua, serializedData);
+            if (data.get_type() != sol::type::table)
+                throw std::runtime_error("the storage is not a table");
+            for (const auto& [sectionName, sectionTable] : data.as<sol::table>())
             {
+                if (sectionName.get_type() != sol::type::string || sectionTable.get_type() != sol::type::table)
+                {
+                    Log(Debug::Error) << "Invalid section in \"" << path << "\" is skipped";
+                    continue;
+                }
                 const std::shared_ptr<Section>& section = getSection(cast<std::string_view>(sectionName));
                 for (const auto& [key, value] : cast<sol::table>(sectionTable))
-                    section->set(cast<std::string_view>(key), value);
+                {
+                    if (key.get_type() == sol::type::string)
+                        section->set(cast<std::string_view>(key), value);
+                    else
+                        Log(Debug::Error) << "Invalid key in section \"" << section->mSectionName << "\" is skipped";
+                }
             }
         }
         catch (std::exception& e)
         {
             Log(Debug::Error) << "Can not read \"" << path << "\": " << e.what();
+            // The file will be overwritten on exit, so keep a copy of it for investigation or manual recovery.
+            std::filesystem::path backupPath = path;
+            backupPath += ".corrupted";
+            std::error_code ec;
+            std::filesystem::copy_file(path, backupPath, std::filesystem::copy_options::overwrite_existing, ec);
+            if (!ec)
+                Log(Debug::Error) << "The file is copied to \"" << backupPath << "\"";
         }
     }
 
-    void LuaStorage::save(const std::filesystem::path& path) const
+    BinaryData LuaStorage::serializePermanentSections() const
     {
-        sol::table data(mLua, sol::create);
+        SerializedTableBuilder builder;
         for (const auto& [sectionName, section] : mData)
         {
             if (section->mPermanent && !section->mValues.empty())
-                data[sectionName] = section->asTable();
+                builder.add(sectionName, section->getSerialized());
+        }
+        return std::move(builder).finish();
+    }
+
+    void LuaStorage::writeToFile(const std::filesystem::path& path, std::string_view data)
+    {
+        Log(Debug::Info) << "Saving Lua storage \"" << path << "\" (" << data.size() << " bytes)";
+        std::filesystem::path tmpPath = path;
+        tmpPath += ".tmp";
+        {
+            std::ofstream fout(tmpPath, std::fstream::binary);
+            fout.write(data.data(), data.size());
+            fout.close();
+            if (!fout)
+            {
+                Log(Debug::Error) << "Can not write \"" << tmpPath << "\"";
+                return;
+            }
         }
-        std::string serializedData = serialize(data);
-        Log(Debug::Info) << "Saving Lua storage \"" << path << "\" (" << serializedData.size() << " bytes)";
-        std::ofstream fout(path, std::fstream::binary);
-        fout.write(serializedData.data(), serializedData.size());
-        fout.close();
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec)
+            Log(Debug::Error) << "Can not rename \"" << tmpPath << "\" to \"" << path << "\": " << ec.message();
     }
 
     const std::shared_ptr<LuaStorage::Section>& LuaStorage::getSection(std::string_view sectionName)
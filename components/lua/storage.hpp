@@ -25,7 +25,15 @@ namespace LuaUtil
 
         void clearTemporaryAndRemoveCallbacks();
         void load(const std::filesystem::path& path);
-        void save(const std::filesystem::path& path) const;
+        void save(const std::filesystem::path& path) const { writeToFile(path, serializePermanentSections()); }
+
+        // Serializes all permanent sections without using Lua, so the result can be written to a file in another
+        // thread. Only sections that were modified since the previous call are serialized again.
+        BinaryData serializePermanentSections() const;
+
+        // Writes data to a temporary file and then renames it to `path`, so the previous version of the file
+        // remains valid if the game crashes during writing.
+        static void writeToFile(const std::filesystem::path& path, std::string_view data);
 
         sol::object getSection(std::string_view sectionName, bool readOnly);
         sol::object getMutableSection(std::string_view sectionName) { return getSection(sectionName, false); }
@@ -63,6 +71,7 @@ namespace LuaUtil
             }
             sol::object getCopy(lua_State* L) const;
             sol::object getReadOnly(lua_State* L) const;
+            std::string_view getSerialized() const { return mSerializedValue; }
 
         private:
             std::string mSerializedValue;
@@ -80,6 +89,7 @@ namespace LuaUtil
             void set(std::string_view key, const sol::object& value);
             void setAll(const sol::optional<sol::table>& values);
             sol::table asTable();
+            const BinaryData& getSerialized() const;
             void runCallbacks(sol::optional<std::string_view> changedKey);
             void throwIfCallbackRecursionIsTooDeep();
 
@@ -88,6 +98,8 @@ namespace LuaUtil
             std::map<std::string, Value, std::less<>> mValues;
             std::vector<Callback> mCallbacks;
             bool mPermanent = true;
+            mutable BinaryData mSerialized; // the cache for getSerialized
+            mutable bool mSerializedValid = false;
             static Value sEmpty;
         };
         struct SectionView
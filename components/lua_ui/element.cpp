@@ -1,5 +1,10 @@
 #include "element.hpp"
 
+#include <chrono>
+#include <map>
+#include <optional>
+#include <utility>
+
 #include <MyGUI_Gui.h>
 
 #include "content.hpp"
@@ -26,6 +31,26 @@ namespace LuaUi
 
         constexpr uint64_t maxDepth = 250;
 
+        Element::UpdateStats updateStats;
+
+        class UpdateTimer
+        {
+        public:
+            UpdateTimer()
+                : mStart(std::chrono::steady_clock::now())
+            {
+            }
+
+            ~UpdateTimer()
+            {
+                const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - mStart;
+                updateStats.mTime += duration.count();
+            }
+
+        private:
+            std::chrono::steady_clock::time_point mStart;
+        };
+
         std::string widgetType(const sol::table& layout)
         {
             sol::object typeField = LuaUtil::getFieldOrNil(layout, LayoutKeys::type);
@@ -43,8 +68,19 @@ namespace LuaUi
             return type;
         }
 
+        size_t countWidgets(LuaUi::WidgetExtension* ext)
+        {
+            size_t result = 1;
+            for (WidgetExtension* w : ext->children())
+                result += countWidgets(w);
+            for (WidgetExtension* w : ext->templateChildren())
+                result += countWidgets(w);
+            return result;
+        }
+
         void destroyWidget(LuaUi::WidgetExtension* ext)
         {
+            updateStats.mDestroyed += countWidgets(ext);
             ext->deinitialize();
             MyGUI::Gui::getInstancePtr()->destroyWidget(ext->widget());
         }
@@ -65,26 +101,52 @@ namespace LuaUi
             }
             ContentView content(LuaUtil::cast<sol::table>(contentObj));
             result.resize(content.size());
-            size_t minSize = std::min(children.size(), content.size());
-            for (size_t i = 0; i < minSize; i++)
+
+            // Named widgets are matched by name, so inserting or removing a child doesn't recreate its siblings.
+            // Unnamed widgets are matched by position.
+            std::multimap<std::string_view, size_t> namedChildren;
+            for (size_t i = 0; i < children.size(); i++)
+            {
+                const std::string& name = children[i]->widget()->getName();
+                if (!name.empty())
+                    namedChildren.emplace(name, i);
+            }
+            std::vector<bool> reused(children.size(), false);
+            for (size_t i = 0; i < content.size(); i++)
             {
-                WidgetExtension* ext = children[i];
                 sol::table newLayout = content.at(i);
-                if (ext->widget()->getTypeName() == widgetType(newLayout))
+                std::string type = widgetType(newLayout);
+                std::string name = newLayout.get_or(LayoutKeys::name, std::string());
+                auto matches = [&](size_t index) {
+                    MyGUI::Widget* widget = children[index]->widget();
+                    return !reused[index] && widget->getTypeName() == type && widget->getName() == name;
+                };
+                std::optional<size_t> match;
+                if (!name.empty())
                 {
-                    updateWidget(ext, newLayout, depth);
+                    auto [begin, end] = namedChildren.equal_range(name);
+                    for (auto it = begin; it != end && !match; ++it)
+                        if (matches(it->second))
+                            match = it->second;
                 }
-                else
+                else if (i < children.size() && matches(i))
+                    match = i;
+
+                if (match)
                 {
-                    destroyWidget(ext);
-                    ext = createWidget(newLayout, depth);
+                    reused[*match] = true;
+                    result[i] = children[*match];
+                    ++updateStats.mUpdated;
+                    updateWidget(result[i], newLayout, depth);
                 }
-                result[i] = ext;
+                else
+                    result[i] = createWidget(newLayout, depth);
+            }
+            for (size_t i = 0; i < children.size(); i++)
+            {
+                if (!reused[i])
+                    destroyWidget(children[i]);
             }
-            for (size_t i = minSize; i < children.size(); i++)
-                destroyWidget(children[i]);
-            for (size_t i = minSize; i < content.size(); i++)
-                result[i] = createWidget(content.at(i), depth);
             return result;
         }
 
@@ -132,6 +194,7 @@ namespace LuaUi
                 throw std::runtime_error("Invalid widget!");
             ext->initialize(layout.lua_state(), widget);
 
+            ++updateStats.mCreated;
             updateWidget(ext, layout, depth);
             return ext;
         }
@@ -147,7 +210,7 @@ namespace LuaUi
             ext->setProperties(layout.get<sol::object>(LayoutKeys::props));
             setEventCallbacks(ext, layout.get<sol::object>(LayoutKeys::events));
             ext->setChildren(updateContent(ext->children(), layout.get<sol::object>(LayoutKeys::content), depth));
-            ext->updateCoord();
+            // Coordinates are updated once for the whole element, see Element::updateAttachment
         }
 
         std::string setLayer(WidgetExtension* ext, const sol::table& layout)
@@ -189,6 +252,7 @@ namespace LuaUi
         assert(!mRoot);
         if (!mRoot)
         {
+            UpdateTimer timer;
             mRoot = createWidget(layout(), 0);
             mLayer = setLayer(mRoot, layout());
             updateAttachment();
@@ -199,6 +263,7 @@ namespace LuaUi
     {
         if (mRoot && mUpdate)
         {
+            UpdateTimer timer;
             if (mRoot->widget()->getTypeName() != widgetType(layout()))
             {
                 destroyWidget(mRoot);
@@ -206,6 +271,7 @@ namespace LuaUi
             }
             else
             {
+                ++updateStats.mUpdated;
                 updateWidget(mRoot, layout(), 0);
             }
             mLayer = setLayer(mRoot, layout());
@@ -218,6 +284,7 @@ namespace LuaUi
     {
         if (mRoot)
         {
+            UpdateTimer timer;
             destroyWidget(mRoot);
             mRoot = nullptr;
             mLayout = sol::make_object(mLayout.lua_state(), sol::nil);
@@ -253,5 +320,12 @@ namespace LuaUi
             mAttachedTo->setChildren({ mRoot });
             mAttachedTo->updateCoord();
         }
+        else
+            mRoot->updateCoord();
+    }
+
+    Element::UpdateStats Element::takeUpdateStats()
+    {
+        return std::exchange(updateStats, UpdateStats{});
     }
 }
@@ -16,6 +16,18 @@ namespace LuaUi
                 callback(e);
         }
 
+        // Cost of creating, updating and destroying UI elements, used by the Lua profiler
+        struct UpdateStats
+        {
+            double mTime = 0; // in milliseconds
+            size_t mCreated = 0;
+            size_t mUpdated = 0;
+            size_t mDestroyed = 0;
+        };
+
+        // Returns the stats accumulated since the previous call
+        static UpdateStats takeUpdateStats();
+
         WidgetExtension* mRoot;
         WidgetExtension* mAttachedTo;
         sol::object mLayout;
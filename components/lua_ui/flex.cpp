@@ -73,7 +73,6 @@ namespace LuaUi
             secondary(childPosition) = alignSize(secondary(flexSize), secondary(size), mArrange);
             w->forcePosition(childPosition);
             w->forceSize(size);
-            w->updateCoord();
             primary(childPosition) += primary(size);
         }
         WidgetExtension::updateChildren();
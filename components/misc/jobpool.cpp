@@ -0,0 +1,98 @@
+#include "jobpool.hpp"
+
+#include <utility>
+
+namespace Misc
+{
+    JobPool::JobPool(std::size_t threads)
+    {
+        mThreads.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+            mThreads.emplace_back([this] { process(); });
+    }
+
+    JobPool::~JobPool()
+    {
+        {
+            const std::lock_guard lock(mMutex);
+            mShouldStop = true;
+        }
+        mHasWork.notify_all();
+        for (std::thread& thread : mThreads)
+            thread.join();
+    }
+
+    void JobPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& function)
+    {
+        if (count == 0)
+            return;
+
+        if (mThreads.empty() || count == 1)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                function(i);
+            return;
+        }
+
+        {
+            const std::lock_guard lock(mMutex);
+            mFunction = &function;
+            mCount = count;
+            mNextIndex = 0;
+            mException = nullptr;
+            mBusyThreads = mThreads.size();
+            ++mGeneration;
+        }
+        mHasWork.notify_all();
+
+        runJobs();
+
+        std::unique_lock lock(mMutex);
+        mWorkDone.wait(lock, [&] { return mBusyThreads == 0; });
+        mFunction = nullptr;
+        if (mException != nullptr)
+            std::rethrow_exception(std::exchange(mException, nullptr));
+    }
+
+    void JobPool::runJobs()
+    {
+        try
+        {
+            for (std::size_t i = mNextIndex++; i < mCount; i = mNextIndex++)
+                (*mFunction)(i);
+        }
+        catch (...)
+        {
+            // Make other threads stop taking new jobs
+            mNextIndex = mCount;
+            const std::lock_guard lock(mMutex);
+            if (mException == nullptr)
+                mException = std::current_exception();
+        }
+    }
+
+    void JobPool::process()
+    {
+        std::size_t generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock(mMutex);
+                mHasWork.wait(lock, [&] { return mShouldStop || mGeneration != generation; });
+                if (mShouldStop)
+                    return;
+                generation = mGeneration;
+            }
+
+            runJobs();
+
+            bool done = false;
+            {
+                const std::lock_guard lock(mMutex);
+                done = --mBusyThreads == 0;
+            }
+            if (done)
+                mWorkDone.notify_one();
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef OPENMW_COMPONENTS_MISC_JOBPOOL_H
+#define OPENMW_COMPONENTS_MISC_JOBPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Misc
+{
+    /// @brief Runs indexed jobs on a fixed set of threads together with the calling thread. Intended for short
+    /// per-frame work split into independent parts, the caller is blocked until all parts are done.
+    class JobPool
+    {
+    public:
+        /// @param threads number of background threads, with 0 all jobs run on the calling thread
+        explicit JobPool(std::size_t threads);
+
+        ~JobPool();
+
+        JobPool(const JobPool&) = delete;
+        JobPool& operator=(const JobPool&) = delete;
+
+        std::size_t getThreadsCount() const { return mThreads.size(); }
+
+        /// @brief calls function for each index in [0, count) and waits until all calls are done.
+        /// Calls are distributed over threads in no particular order. If any call throws, remaining indices are
+        /// skipped and the first exception is rethrown. Must not be called concurrently or from a job.
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)>& function);
+
+    private:
+        std::mutex mMutex;
+        std::condition_variable mHasWork;
+        std::condition_variable mWorkDone;
+        std::size_t mGeneration = 0;
+        std::size_t mBusyThreads = 0;
+        bool mShouldStop = false;
+        const std::function<void(std::size_t)>* mFunction = nullptr;
+        std::size_t mCount = 0;
+        std::atomic_size_t mNextIndex{ 0 };
+        std::exception_ptr mException;
+        std::vector<std::thread> mThreads;
+
+        void runJobs();
+
+        void process();
+    };
+}
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef OPENMW_COMPONENTS_MISC_UNIFORMGRID_H
+#define OPENMW_COMPONENTS_MISC_UNIFORMGRID_H
+
+#include <osg/Vec2f>
+#include <osg/Vec2i>
+#include <osg/Vec3f>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+namespace Misc
+{
+    /// Index over XY plane for proximity queries of points which are added once and queried many times. Values
+    /// are added, then build() makes the index usable for findInRange() until the next clear().
+    template <class T>
+    class UniformGrid
+    {
+    public:
+        explicit UniformGrid(float cellSize)
+            : mCellSize(cellSize)
+        {
+            assert(cellSize > 0);
+        }
+
+        std::size_t size() const { return mValues.size(); }
+
+        bool isBuilt() const { return mBuilt; }
+
+        const T& operator[](std::size_t index) const { return mValues[index]; }
+
+        void clear()
+        {
+            mValues.clear();
+            mPositions.clear();
+            mEntries.clear();
+            mBuilt = false;
+        }
+
+        void add(const osg::Vec3f& position, const T& value)
+        {
+            assert(!mBuilt);
+            mEntries.push_back(Entry{ getCell(position), mValues.size() });
+            mValues.push_back(value);
+            mPositions.push_back(position);
+        }
+
+        void build()
+        {
+            std::sort(mEntries.begin(), mEntries.end());
+            mMinCell = osg::Vec2i(std::numeric_limits<int>::max(), std::numeric_limits<int>::max());
+            mMaxCell = osg::Vec2i(std::numeric_limits<int>::min(), std::numeric_limits<int>::min());
+            for (const Entry& entry : mEntries)
+            {
+                mMinCell.x() = std::min(mMinCell.x(), entry.mCell.x());
+                mMinCell.y() = std::min(mMinCell.y(), entry.mCell.y());
+                mMaxCell.x() = std::max(mMaxCell.x(), entry.mCell.x());
+                mMaxCell.y() = std::max(mMaxCell.y(), entry.mCell.y());
+            }
+            mBuilt = true;
+        }
+
+        /// Appends to out indices of values within the radius from the position in the order they were added.
+        void findInRange(const osg::Vec3f& position, float radius, std::vector<std::size_t>& out) const
+        {
+            assert(mBuilt);
+            if (mEntries.empty())
+                return;
+            const float sqrRadius = radius * radius;
+            const osg::Vec2f minCell = getCellPosition(position - osg::Vec3f(radius, radius, 0));
+            const osg::Vec2f maxCell = getCellPosition(position + osg::Vec3f(radius, radius, 0));
+            if (maxCell.x() < mMinCell.x() || maxCell.y() < mMinCell.y() || minCell.x() > mMaxCell.x()
+                || minCell.y() > mMaxCell.y())
+                return;
+            const osg::Vec2i min = clampCell(minCell);
+            const osg::Vec2i max = clampCell(maxCell);
+            // When the range covers a big part of the grid a linear scan is cheaper and gives ordered result as is.
+            // Measured by apps/benchmarks/misc/uniformgrid.cpp the grid is faster only when the query covers less
+            // than about a quarter of the occupied cells.
+            if (4 * getCellsCount(min, max) >= getCellsCount(mMinCell, mMaxCell))
+            {
+                for (std::size_t i = 0; i < mPositions.size(); ++i)
+                    if ((mPositions[i] - position).length2() <= sqrRadius)
+                        out.push_back(i);
+                return;
+            }
+            const std::size_t begin = out.size();
+            // Entries are ordered by row first so each row of cells is a contiguous range, skip to the next row
+            // when the current one leaves the range
+            auto it = std::lower_bound(mEntries.begin(), mEntries.end(), Entry{ min, 0 });
+            while (it != mEntries.end() && it->mCell.y() <= max.y())
+            {
+                if (it->mCell.x() < min.x())
+                {
+                    it = std::lower_bound(it, mEntries.end(), Entry{ osg::Vec2i(min.x(), it->mCell.y()), 0 });
+                    continue;
+                }
+                if (it->mCell.x() > max.x())
+                {
+                    if (it->mCell.y() == max.y())
+                        break;
+                    it = std::lower_bound(it, mEntries.end(), Entry{ osg::Vec2i(min.x(), it->mCell.y() + 1), 0 });
+                    continue;
+                }
+                if ((mPositions[it->mIndex] - position).length2() <= sqrRadius)
+                    out.push_back(it->mIndex);
+                ++it;
+            }
+            std::sort(out.begin() + begin, out.end());
+        }
+
+    private:
+        struct Entry
+        {
+            osg::Vec2i mCell;
+            std::size_t mIndex;
+
+            friend bool operator<(const Entry& lhs, const Entry& rhs)
+            {
+                return std::make_tuple(lhs.mCell.y(), lhs.mCell.x(), lhs.mIndex)
+                    < std::make_tuple(rhs.mCell.y(), rhs.mCell.x(), rhs.mIndex);
+            }
+        };
+
+        float mCellSize;
+        bool mBuilt = false;
+        osg::Vec2i mMinCell;
+        osg::Vec2i mMaxCell;
+        std::vector<T> mValues;
+        std::vector<osg::Vec3f> mPositions;
+        std::vector<Entry> mEntries;
+
+        osg::Vec2f getCellPosition(const osg::Vec3f& position) const
+        {
+            return osg::Vec2f(std::floor(position.x() / mCellSize), std::floor(position.y() / mCellSize));
+        }
+
+        osg::Vec2i getCell(const osg::Vec3f& position) const
+        {
+            const osg::Vec2f cell = getCellPosition(position);
+            return osg::Vec2i(static_cast<int>(cell.x()), static_cast<int>(cell.y()));
+        }
+
+        static long long getCellsCount(const osg::Vec2i& min, const osg::Vec2i& max)
+        {
+            return (static_cast<long long>(max.x()) - min.x() + 1) * (static_cast<long long>(max.y()) - min.y() + 1);
+        }
+
+        // Query bounds may be far outside of int range for a big radius so clamp before conversion
+        osg::Vec2i clampCell(const osg::Vec2f& cell) const
+        {
+            return osg::Vec2i(static_cast<int>(std::clamp<float>(cell.x(), mMinCell.x(), mMaxCell.x())),
+                static_cast<int>(std::clamp<float>(cell.y(), mMinCell.y(), mMaxCell.y())));
+        }
+    };
+}
+
+#endif
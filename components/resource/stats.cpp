@@ -455,6 +455,8 @@ namespace Resource
                 "NavMesh CachedTiles",
                 "NavMesh Cache Get",
                 "NavMesh Cache Hit",
+                "NavMesh Latency Req",
+                "NavMesh Latency Reg",
                 "",
                 "Mechanics Actors",
                 "Mechanics Objects",
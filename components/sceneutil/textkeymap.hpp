@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -32,6 +33,10 @@ namespace SceneUtil
             if (separator != std::string::npos)
                 mGroups.emplace(textKey.substr(0, separator));
 
+            const auto [it, inserted] = mTimeByTextKey.emplace(textKey, time);
+            if (!inserted)
+                it->second = std::min(it->second, time);
+
             mTextKeyByTime.emplace(time, std::move(textKey));
         }
 
@@ -44,6 +49,17 @@ namespace SceneUtil
 
         bool hasGroupStart(std::string_view groupName) const { return mGroups.count(groupName) > 0; }
 
+        /// Returns time of the earliest text key starting with the prefix
+        std::optional<float> findFirstTime(std::string_view prefix) const
+        {
+            std::optional<float> result;
+            for (auto it = mTimeByTextKey.lower_bound(prefix);
+                 it != mTimeByTextKey.end() && it->first.starts_with(prefix); ++it)
+                if (!result.has_value() || it->second < *result)
+                    result = it->second;
+            return result;
+        }
+
         const std::set<std::string, std::less<>>& getGroups() const { return mGroups; }
 
     private:
@@ -59,6 +75,8 @@ namespace SceneUtil
 
         std::set<std::string, std::less<>> mGroups;
         std::multimap<float, std::string> mTextKeyByTime;
+        // Ordered by text key to find a key by prefix without scanning all of them
+        std::map<std::string, float, std::less<>> mTimeByTextKey;
     };
 }
 
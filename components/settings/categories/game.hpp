@@ -58,6 +58,9 @@ namespace Settings
             makeMaxSanitizerFloat(0.01f) };
         SettingValue<bool> mNPCsAvoidCollisions{ mIndex, "Game", "NPCs avoid collisions" };
         SettingValue<bool> mNPCsGiveWay{ mIndex, "Game", "NPCs give way" };
+        SettingValue<std::size_t> mNPCsAvoidCollisionsThreads{ mIndex, "Game", "NPCs avoid collisions threads" };
+        SettingValue<float> mAiLodDistance{ mIndex, "Game", "ai lod distance", makeMaxSanitizerFloat(0) };
+        SettingValue<int> mAiLodMaxInterval{ mIndex, "Game", "ai lod max interval", makeMaxSanitizerInt(1) };
         SettingValue<bool> mSwimUpwardCorrection{ mIndex, "Game", "swim upward correction" };
         SettingValue<float> mSwimUpwardCoef{ mIndex, "Game", "swim upward coef", makeClampSanitizerFloat(-1, 1) };
         SettingValue<bool> mTrainersTrainingSkillsBasedOnBaseSkill{ mIndex, "Game",
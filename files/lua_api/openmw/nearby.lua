@@ -40,6 +40,70 @@
 -- @return openmw.core#GameObject
 -- @usage local obj = nearby.getObjectByFormId(core.getFormId('Morrowind.esm', 128964))
 
+---
+-- @type OBJECT_GROUP
+-- @field [parent=#OBJECT_GROUP] #number Activators
+-- @field [parent=#OBJECT_GROUP] #number Actors
+-- @field [parent=#OBJECT_GROUP] #number Containers
+-- @field [parent=#OBJECT_GROUP] #number Doors
+-- @field [parent=#OBJECT_GROUP] #number Items
+-- @field [parent=#OBJECT_GROUP] #number All
+
+---
+-- Groups of objects (the same as lists `nearby.activators`, `nearby.actors`, etc) that are used in spatial queries.
+-- Several groups can be combined with @{openmw_util#util.bitOr}.
+-- @field [parent=#nearby] #OBJECT_GROUP OBJECT_GROUP
+
+---
+-- A table of parameters for spatial queries (@{#nearby.findInSphere}, @{#nearby.findInBox}, @{#nearby.findInCone},
+-- @{#nearby.findNearest}). All positions and distances given to these functions must be finite.
+-- @type FindObjectsOptions
+-- @field #number groups Groups of objects to search in (see @{#OBJECT_GROUP}); all groups by default.
+-- @field openmw.core#GameObject ignore An object to exclude from the result (e.g. `self`).
+-- @field #number maxDistance Only for `findNearest`: don't return objects that are further than this distance
+--  (unlimited by default). Setting it makes the query faster.
+
+---
+-- Find nearby objects within a sphere. The order of the result is not specified.
+-- @function [parent=#nearby] findInSphere
+-- @param openmw.util#Vector3 center
+-- @param #number radius
+-- @param #FindObjectsOptions options An optional table with additional arguments.
+-- @return openmw.core#ObjectList
+-- @usage local actors = nearby.findInSphere(self.position, 1000, {
+--     groups = nearby.OBJECT_GROUP.Actors,
+--     ignore = self,
+-- })
+
+---
+-- Find nearby objects within an axis-aligned box. The order of the result is not specified.
+-- @function [parent=#nearby] findInBox
+-- @param openmw.util#Vector3 min Minimal corner of the box.
+-- @param openmw.util#Vector3 max Maximal corner of the box.
+-- @param #FindObjectsOptions options An optional table with additional arguments.
+-- @return openmw.core#ObjectList
+
+---
+-- Find nearby objects within a cone. The order of the result is not specified.
+-- @function [parent=#nearby] findInCone
+-- @param openmw.util#Vector3 apex
+-- @param openmw.util#Vector3 direction Direction of the axis of the cone (doesn't need to be normalized).
+-- @param #number angle Angle between the axis and the side of the cone in radians.
+-- @param #number distance Maximal distance from the apex.
+-- @param #FindObjectsOptions options An optional table with additional arguments.
+-- @return openmw.core#ObjectList
+-- @usage local visibleItems = nearby.findInCone(camera.getPosition(), camera.viewportToWorldVector(util.vector2(0.5, 0.5)),
+--     math.rad(30), 2000, { groups = nearby.OBJECT_GROUP.Items })
+
+---
+-- Find up to `count` nearby objects that are the closest to the given position. The result is sorted by distance.
+-- @function [parent=#nearby] findNearest
+-- @param openmw.util#Vector3 position
+-- @param #number count
+-- @param #FindObjectsOptions options An optional table with additional arguments.
+-- @return openmw.core#ObjectList
+-- @usage local closestDoor = nearby.findNearest(self.position, 1, { groups = nearby.OBJECT_GROUP.Doors })[1]
+
 ---
 -- @type COLLISION_TYPE
 -- @field [parent=#COLLISION_TYPE] #number World